@@ -25,13 +25,16 @@
 #define ENGINE_H
 
 #include "events.h"
+#include "graphics/renderer.h"
 #include "viewport/window.h"
 #include "thirdparty/squirrel/scriptvm.h"
 
 class Engine {
     static Engine singleton;
     ScriptVM vm;
-    Window * window;
+    Window * window = nullptr;
+    RenderDevice * device = nullptr;
+    Renderer * renderer = nullptr;
     Event event;
     double accumulator = 0;
     const double fixed_dt = 1.0 / 60.0;
@@ -47,7 +50,8 @@ public:
 
     void run();
     Window * get_window() const { return window; }
-    ScriptVM get_vm() const { return vm; }
+    Renderer * get_renderer() const { return renderer; }
+    ScriptVM * get_vm() { return &vm; }
 };
 
 #endif
\ No newline at end of file
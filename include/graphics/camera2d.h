@@ -0,0 +1,51 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#ifndef CAMERA2D_H
+#define CAMERA2D_H
+
+#include "math/rect2.h"
+#include "math/vector2.h"
+
+class Camera2D {
+    Vector2 position;
+    double zoom = 1;
+    double rotation = 0;
+
+public:
+    Camera2D() {}
+    Camera2D(const Vector2 & position, double zoom = 1, double rotation = 0) : position(position), zoom(zoom), rotation(rotation) {}
+
+    void get_projection(double width, double height, float matrix[16]) const;
+    Rect2 get_visible_rect(double width, double height) const;
+    Vector2 screen_to_world(const Vector2 & point, double width, double height) const;
+
+    void set_position(const Vector2 & position) { this->position = position; }
+    void set_zoom(double zoom) { this->zoom = zoom; }
+    void set_rotation(double rotation) { this->rotation = rotation; }
+    const Vector2 & get_position() const { return position; }
+    double get_zoom() const { return zoom; }
+    double get_rotation() const { return rotation; }
+};
+
+#endif
\ No newline at end of file
@@ -24,16 +24,81 @@
 #ifndef FONT_H
 #define FONT_H
 
+#include "graphics/rect_packer.h"
+#include "graphics/text.h"
+#include "math/vector2.h"
+#include <GL/glew.h>
 #include <SDL2/SDL_ttf.h>
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#define FONT_SDF_SIZE 48
+#define FONT_SDF_SPREAD 6
+
+class Renderer;
+
+enum TextAlign {
+    ALIGN_LEFT,
+    ALIGN_CENTER,
+    ALIGN_RIGHT
+};
+
+struct TextLine {
+    size_t start;
+    size_t length;
+    double x;
+    double y;
+    double width;
+};
 
 class Font {
-    TTF_Font * font;
+    struct Glyph {
+        GLuint texture;
+        SDL_Rect rect;
+        int offset;
+        int top;
+    };
+
+    Renderer * renderer;
+    std::string path;
+    const void * data;
+    size_t data_size;
+    int size;
+    bool sdf;
+    Font * face = nullptr;
+    TTF_Font * font = nullptr;
+    bool failed = false;
+    std::unordered_map<Uint32, Glyph> glyphs;
+    std::unordered_map<Uint32, int> advances;
+    std::unordered_map<uint64_t, int> kernings;
+    std::vector<GLuint> pages;
+    RectPacker packer;
+    std::list<std::pair<std::string, TextMesh>> cache;
+    std::unordered_map<std::string_view, std::list<std::pair<std::string, TextMesh>>::iterator> cache_index;
+
+    bool open();
+    const Glyph & get_glyph(Uint32 codepoint);
+    int get_advance(Uint32 codepoint);
+    int get_kerning(Uint32 previous, Uint32 codepoint);
+    double measure_line(const char * start, const char * end);
 
 public:
-    Font(const char * path, int size);
+    Font(Renderer * renderer, const std::string & path, const void * data, size_t data_size, int size, bool sdf = false);
+    Font(Font * face, int size);
     ~Font();
 
-    TTF_Font * get_font() const { return font; }
+    void build_text(const char * text, SDL_Color color, TextMesh & mesh);
+    void draw_text(Renderer * renderer, const char * text, const Vector2 & position);
+    Vector2 measure_text(const char * text);
+    void layout_text(const char * text, double max_width, TextAlign align, std::vector<TextLine> & lines);
+    TTF_Font * get_font() { return face ? face->get_font() : open() ? font : nullptr; }
+    const std::string & get_path() const { return path; }
+    int get_size() const { return size; }
+    bool is_sdf() const { return sdf; }
+    Font * get_face() const { return face; }
 };
 
 #endif
\ No newline at end of file
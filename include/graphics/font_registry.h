@@ -0,0 +1,75 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#ifndef FONT_REGISTRY_H
+#define FONT_REGISTRY_H
+
+#include <stddef.h>
+#include <list>
+#include <map>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+
+#define FONT_REGISTRY_MAX_UNUSED 8
+#define FONT_DEFAULT_PATH "/usr/share/fonts/noto/NotoSans-Condensed.ttf"
+#define FONT_DEFAULT_SIZE 12
+
+class Font;
+class Renderer;
+
+class FontRegistry {
+    struct FontFile {
+        void * data;
+        size_t size;
+        int references;
+    };
+
+    struct Entry {
+        Font * font;
+        int references;
+        std::list<Font *>::iterator unused;
+    };
+
+    Renderer * renderer;
+    std::unordered_map<std::string, FontFile> files;
+    std::map<std::tuple<std::string, int, bool>, Entry> fonts;
+    std::list<Font *> unused;
+    Font * default_font = nullptr;
+    bool default_font_loaded = false;
+
+    FontFile * map_file(const std::string & path);
+    void unmap_file(const std::string & path);
+    void evict();
+
+public:
+    explicit FontRegistry(Renderer * renderer) : renderer(renderer) {}
+    ~FontRegistry();
+
+    void clear();
+    Font * acquire(const std::string & path, int size, bool sdf = false);
+    void release(Font * font);
+    Font * get_default_font();
+};
+
+#endif
\ No newline at end of file
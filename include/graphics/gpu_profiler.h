@@ -0,0 +1,79 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#ifndef GPU_PROFILER_H
+#define GPU_PROFILER_H
+
+#include <GL/glew.h>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#define PROFILER_FRAMES 3
+
+class RenderDevice;
+
+class GpuProfiler {
+    struct Pass {
+        std::string name;
+        size_t start;
+        size_t end;
+    };
+
+    struct Frame {
+        GLuint query = 0;
+        std::vector<GLuint> timestamps;
+        size_t used = 0;
+        std::vector<Pass> passes;
+        bool pending = false;
+    };
+
+    Frame frames[PROFILER_FRAMES];
+    int current = 0;
+    bool supported;
+    bool running = false;
+    std::vector<size_t> open_passes;
+    uint64_t cpu_start = 0;
+    double gpu_time = 0;
+    double cpu_time = 0;
+    std::unordered_map<std::string, double> pass_times;
+
+    GLuint next_timestamp(Frame & frame);
+    void collect(Frame & frame);
+
+public:
+    explicit GpuProfiler(RenderDevice * device);
+    ~GpuProfiler();
+
+    void begin_frame();
+    void end_frame();
+    void begin_pass(const std::string & name);
+    void end_pass();
+    bool is_supported() const { return supported; }
+    double get_gpu_time() const { return gpu_time; }
+    double get_cpu_time() const { return cpu_time; }
+    const std::unordered_map<std::string, double> & get_pass_times() const { return pass_times; }
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,62 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#ifndef NULL_DEVICE_H
+#define NULL_DEVICE_H
+
+#include "graphics/render_device.h"
+
+class NullDevice : public RenderDevice {
+    GLuint next_handle = 1;
+
+protected:
+    void start_frame(int width, int height) override {}
+    void bind_texture(GLuint texture) override {}
+    void apply_blend_mode(BlendMode blend) override {}
+    void apply_offset(float x, float y) override {}
+    void write_vertices(const Vertex * vertices, size_t count) override {}
+    void draw_arrays(GLenum mode, GLuint buffer, GLint first, GLsizei count) override {}
+    void write_instances(const Instance * instances, size_t count) override {}
+    void draw_instances(GLint first, GLsizei count) override {}
+
+public:
+    bool has_context() const override { return false; }
+    const char * get_name() const override { return "null"; }
+
+    void end_frame() override {}
+    void set_viewport(int width, int height) override {}
+    void set_projection(const float matrix[16]) override {}
+    void bind_framebuffer(GLuint framebuffer) override {}
+    void clear(float r, float g, float b, float a) override {}
+
+    GLuint create_texture(int width, int height, GLenum format, GLenum type, const void * pixels, int row_length = 0) override { return next_handle++; }
+    void update_texture(GLuint texture, int x, int y, int width, int height, GLenum format, GLenum type, const void * pixels, int row_length = 0) override {}
+    void delete_texture(GLuint texture) override {}
+    GLuint create_buffer(const Vertex * vertices, size_t count) override { return next_handle++; }
+    void update_buffer(GLuint buffer, const Vertex * vertices, size_t count) override {}
+    void delete_buffer(GLuint buffer) override {}
+    GLuint create_framebuffer(GLuint texture) override { return next_handle++; }
+    void delete_framebuffer(GLuint framebuffer) override {}
+};
+
+#endif
\ No newline at end of file
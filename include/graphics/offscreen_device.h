@@ -0,0 +1,52 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#ifndef OFFSCREEN_DEVICE_H
+#define OFFSCREEN_DEVICE_H
+
+#include "graphics/gl_device.h"
+#include <EGL/egl.h>
+
+class OffscreenDevice : public GLDevice {
+    EGLDisplay display = EGL_NO_DISPLAY;
+    EGLContext context = EGL_NO_CONTEXT;
+    GLuint framebuffer = 0;
+    GLuint renderbuffer = 0;
+    int width = 0;
+    int height = 0;
+
+protected:
+    void start_frame(int width, int height) override;
+
+public:
+    explicit OffscreenDevice(Window * window) : GLDevice(window) {}
+    ~OffscreenDevice();
+
+    bool initialize() override;
+    const char * get_name() const override { return "offscreen"; }
+
+    void end_frame() override;
+    void bind_framebuffer(GLuint framebuffer) override;
+};
+
+#endif
\ No newline at end of file
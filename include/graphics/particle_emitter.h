@@ -0,0 +1,88 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#ifndef PARTICLE_EMITTER_H
+#define PARTICLE_EMITTER_H
+
+#include "math/vector2.h"
+#include <SDL2/SDL.h>
+#include <math.h>
+#include <stdint.h>
+#include <vector>
+
+class Renderer;
+class Texture;
+
+class ParticleEmitter {
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> vx;
+    std::vector<float> vy;
+    std::vector<float> age;
+    std::vector<float> lifetime;
+    size_t count = 0;
+    size_t capacity;
+    uint32_t seed = 0x9E3779B9;
+    double accumulator = 0;
+
+    Texture * texture = nullptr;
+    Vector2 position;
+    Vector2 gravity;
+    double rate = 0;
+    float min_lifetime = 1;
+    float max_lifetime = 1;
+    float min_speed = 0;
+    float max_speed = 0;
+    float direction = 0;
+    float spread = 2 * M_PI;
+    float start_size = 4;
+    float end_size = 4;
+    float start_color[4] = { 1, 1, 1, 1 };
+    float end_color[4] = { 1, 1, 1, 0 };
+
+    float random(float min, float max);
+    void integrate(float dt);
+    void remove_dead();
+
+public:
+    explicit ParticleEmitter(size_t capacity);
+
+    void emit(size_t amount);
+    void update(double dt);
+    void draw(Renderer * renderer) const;
+    void clear() { count = 0; }
+
+    void set_texture(Texture * texture) { this->texture = texture; }
+    void set_position(const Vector2 & position) { this->position = position; }
+    void set_gravity(const Vector2 & gravity) { this->gravity = gravity; }
+    void set_rate(double rate) { this->rate = rate; }
+    void set_lifetime(float min, float max);
+    void set_speed(float min, float max);
+    void set_direction(float direction, float spread);
+    void set_sizes(float start, float end);
+    void set_start_color(float r, float g, float b, float a);
+    void set_end_color(float r, float g, float b, float a);
+    size_t get_count() const { return count; }
+};
+
+#endif
\ No newline at end of file
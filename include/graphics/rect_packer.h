@@ -0,0 +1,52 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#ifndef RECT_PACKER_H
+#define RECT_PACKER_H
+
+#include <SDL2/SDL.h>
+#include <vector>
+
+class RectPacker {
+    struct Node {
+        int x;
+        int y;
+        int width;
+    };
+
+    int width;
+    int height;
+    std::vector<Node> skyline;
+
+    int fit(size_t index, int w, int h) const;
+
+public:
+    RectPacker(int width, int height);
+
+    bool pack(int w, int h, SDL_Rect & rect);
+    void clear();
+    int get_width() const { return width; }
+    int get_height() const { return height; }
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,153 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#ifndef RENDER_DEVICE_H
+#define RENDER_DEVICE_H
+
+#include <GL/glew.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+class Window;
+
+struct Vertex {
+    float x;
+    float y;
+    float u;
+    float v;
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+    uint8_t a;
+};
+
+struct Instance {
+    float x;
+    float y;
+    float ux;
+    float uy;
+    float vx;
+    float vy;
+    float u0;
+    float v0;
+    float u1;
+    float v1;
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+    uint8_t a;
+};
+
+inline uint8_t color_channel(float value) {
+    if(!(value > 0))
+        return 0;
+    
+    if(value >= 1)
+        return 255;
+    
+    return value * 255 + 0.5f;
+}
+
+enum BlendMode {
+    BLEND_ALPHA,
+    BLEND_ADD,
+    BLEND_MULTIPLY,
+    BLEND_PREMULTIPLIED,
+    BLEND_NONE,
+    BLEND_MAX
+};
+
+enum ShaderProgram {
+    PROGRAM_SPRITE,
+    PROGRAM_SHAPE,
+    PROGRAM_TEXT,
+    PROGRAM_SDF,
+    PROGRAM_MAX
+};
+
+struct RenderStats {
+    size_t draw_calls = 0;
+    size_t vertices = 0;
+    size_t texture_binds = 0;
+    size_t state_changes = 0;
+    size_t uploaded_bytes = 0;
+};
+
+class RenderDevice {
+    RenderStats stats;
+    RenderStats last_stats;
+
+protected:
+    GLuint bound_texture = 0;
+    BlendMode blend = BLEND_ALPHA;
+    float offset_x = 0;
+    float offset_y = 0;
+
+    virtual void start_frame(int width, int height) = 0;
+    virtual void bind_texture(GLuint texture) = 0;
+    virtual void apply_blend_mode(BlendMode blend) = 0;
+    virtual void apply_offset(float x, float y) = 0;
+    virtual void write_vertices(const Vertex * vertices, size_t count) = 0;
+    virtual void draw_arrays(GLenum mode, GLuint buffer, GLint first, GLsizei count) = 0;
+    virtual void write_instances(const Instance * instances, size_t count) = 0;
+    virtual void draw_instances(GLint first, GLsizei count) = 0;
+    void use_texture(GLuint texture);
+
+public:
+    virtual ~RenderDevice() {}
+
+    virtual bool initialize() { return true; }
+    virtual bool has_context() const = 0;
+    virtual const char * get_name() const = 0;
+
+    void begin_frame(int width, int height);
+    virtual void end_frame() = 0;
+    virtual void set_viewport(int width, int height) = 0;
+    virtual void set_projection(const float matrix[16]) = 0;
+    virtual void bind_framebuffer(GLuint framebuffer) = 0;
+    virtual void clear(float r, float g, float b, float a) = 0;
+    void set_blend_mode(BlendMode blend);
+    void set_offset(float x, float y);
+    void upload_vertices(const Vertex * vertices, size_t count);
+    void draw(GLenum mode, GLuint texture, GLuint buffer, GLint first, GLsizei count);
+    virtual bool supports_instancing() const { return true; }
+    void upload_instances(const Instance * instances, size_t count);
+    void draw_instanced(GLuint texture, GLint first, GLsizei count);
+
+    virtual GLuint create_texture(int width, int height, GLenum format, GLenum type, const void * pixels, int row_length = 0) = 0;
+    virtual void update_texture(GLuint texture, int x, int y, int width, int height, GLenum format, GLenum type, const void * pixels, int row_length = 0) = 0;
+    virtual void delete_texture(GLuint texture) = 0;
+    virtual void set_texture_program(GLuint texture, ShaderProgram program) {}
+    virtual GLuint create_buffer(const Vertex * vertices, size_t count) = 0;
+    virtual void update_buffer(GLuint buffer, const Vertex * vertices, size_t count) = 0;
+    virtual void delete_buffer(GLuint buffer) = 0;
+    virtual GLuint create_framebuffer(GLuint texture) = 0;
+    virtual void delete_framebuffer(GLuint framebuffer) = 0;
+
+    const RenderStats & get_stats() const { return last_stats; }
+};
+
+RenderDevice * create_render_device(const std::string & name, Window * window);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,56 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#ifndef RENDER_TARGET_H
+#define RENDER_TARGET_H
+
+#include "math/rect2.h"
+#include <GL/glew.h>
+
+class Renderer;
+
+class RenderTarget {
+    Renderer * renderer;
+    GLuint framebuffer = 0;
+    GLuint texture = 0;
+    int width;
+    int height;
+    bool valid = false;
+    bool active = false;
+
+public:
+    RenderTarget(Renderer * renderer, int width, int height);
+    ~RenderTarget();
+
+    bool begin();
+    bool end();
+    void invalidate() { valid = false; }
+    void draw(const Rect2 & rectangle);
+    bool is_valid() const { return valid; }
+    bool is_active() const;
+    GLuint get_texture() const { return texture; }
+    int get_width() const { return width; }
+    int get_height() const { return height; }
+};
+
+#endif
\ No newline at end of file
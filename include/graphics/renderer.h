@@ -0,0 +1,169 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#ifndef RENDERER_H
+#define RENDERER_H
+
+#include "graphics/camera2d.h"
+#include "graphics/font_registry.h"
+#include "graphics/gpu_profiler.h"
+#include "graphics/render_device.h"
+#include "graphics/texture_atlas.h"
+#include "graphics/texture_loader.h"
+#include "math/rect2.h"
+#include "math/vector2.h"
+#include <GL/glew.h>
+#include <bitset>
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+
+#define RENDERER_MAX_LAYERS 256
+
+struct SpriteInstance {
+    float x;
+    float y;
+    float rotation;
+    float scale;
+    float r;
+    float g;
+    float b;
+    float a;
+};
+
+struct RectangleInstance {
+    float x;
+    float y;
+    float width;
+    float height;
+    float r;
+    float g;
+    float b;
+    float a;
+};
+
+class Renderer {
+    struct Batch {
+        uint64_t key;
+        GLenum mode;
+        GLuint texture;
+        GLuint buffer;
+        BlendMode blend;
+        GLint first;
+        GLsizei count;
+        float offset_x = 0;
+        float offset_y = 0;
+        bool instanced = false;
+    };
+
+    struct Target {
+        GLuint framebuffer;
+        int width;
+        int height;
+        Camera2D camera;
+    };
+
+    RenderDevice * device;
+    std::vector<Vertex> vertices;
+    std::vector<Batch> batches;
+    std::vector<Instance> instances;
+    std::vector<Vertex> sorted_vertices;
+    std::vector<Instance> sorted_instances;
+    std::vector<Batch> sorted_batches;
+    std::bitset<RENDERER_MAX_LAYERS> sorted_layers;
+    int layer = 0;
+    BlendMode blend = BLEND_ALPHA;
+    uint16_t depth = 0;
+    bool needs_sort = false;
+    std::vector<GLuint> released_textures;
+    std::vector<GLuint> released_buffers;
+    std::unordered_map<int, std::vector<float>> circle_tables;
+    TextureAtlas atlas;
+    TextureLoader loader;
+    GpuProfiler profiler;
+    FontRegistry fonts;
+    Rect2 view;
+    Camera2D camera;
+    std::vector<Target> targets;
+    GLuint framebuffer = 0;
+    int width = 0;
+    int height = 0;
+
+    uint64_t make_key(GLuint texture) const;
+    void add_batch(const Batch & batch);
+    void sort_batches();
+    void submit();
+    void set_viewport(int width, int height, const Camera2D & camera);
+    void trim_instances(GLsizei count);
+    void expand_instances();
+    const std::vector<float> & get_unit_circle(int segments);
+
+public:
+    explicit Renderer(RenderDevice * device);
+    ~Renderer();
+
+    // The returned pointer is only valid until the next call that pushes vertices.
+    Vertex * push_vertices(GLenum mode, GLuint texture, GLsizei count);
+    Instance * push_instances(GLuint texture, GLsizei count);
+
+    void fill_rectangle(const Rect2 & rectangle);
+    void draw_rectangle(const Rect2 & rectangle);
+    void fill_circle(const Vector2 & center, double radius);
+    void draw_circle(const Vector2 & center, double radius);
+    void draw_line(const Vector2 & start, const Vector2 & end);
+    void draw_texture(GLuint texture, const Rect2 & rectangle, const Rect2 & uv = Rect2(0, 0, 1, 1));
+    void draw_sprites(GLuint texture, const Rect2 & uv, double width, double height, const SpriteInstance * instances, size_t count);
+    void fill_rectangles(const RectangleInstance * instances, size_t count);
+    void draw_buffer(GLuint buffer, GLenum mode, GLuint texture, GLsizei count, const Vector2 & offset = Vector2());
+
+    // Deletes the texture once the batches referencing it have been submitted.
+    void release_texture(GLuint texture);
+    void release_buffer(GLuint buffer);
+    void begin_frame(int width, int height);
+    void set_camera(const Camera2D & camera);
+    void reset_camera();
+    const Camera2D & get_camera() const { return camera; }
+    int get_width() const { return width; }
+    int get_height() const { return height; }
+    bool is_visible(const Rect2 & bounds) const;
+    void push_target(GLuint framebuffer, int width, int height);
+    bool pop_target(GLuint framebuffer);
+    bool has_target(GLuint framebuffer) const;
+    void flush();
+    void begin_pass(const std::string & name);
+    void end_pass();
+    void set_layer(int layer) { this->layer = layer; }
+    void set_layer_sorted(int layer, bool sorted) { sorted_layers[layer] = sorted; }
+    void set_blend_mode(BlendMode blend) { this->blend = blend; }
+    void set_depth(uint16_t depth) { this->depth = depth; }
+    int get_layer() const { return layer; }
+    BlendMode get_blend_mode() const { return blend; }
+    const Rect2 & get_view() const { return view; }
+    RenderDevice * get_device() const { return device; }
+    TextureAtlas * get_atlas() { return &atlas; }
+    TextureLoader * get_loader() { return &loader; }
+    GpuProfiler * get_profiler() { return &profiler; }
+    FontRegistry * get_fonts() { return &fonts; }
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,54 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#ifndef SHADER_PROGRAM_H
+#define SHADER_PROGRAM_H
+
+#include <GL/glew.h>
+#include <stdint.h>
+
+#define SHADER_CACHE_MAGIC 0x4752504D
+#define SHADER_CACHE_VERSION 1
+#define SHADER_CACHE_DIRECTORY ".shader_cache"
+
+enum VertexAttribute {
+    ATTRIBUTE_POSITION,
+    ATTRIBUTE_UV,
+    ATTRIBUTE_COLOR,
+    ATTRIBUTE_CENTER,
+    ATTRIBUTE_AXIS_U,
+    ATTRIBUTE_AXIS_V,
+    ATTRIBUTE_UV_RECT
+};
+
+struct ShaderCacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t hash;
+    uint32_t format;
+    uint32_t size;
+};
+
+GLuint load_shader_program(const char * name, const char * vertex_source, const char * fragment_source);
+
+#endif
\ No newline at end of file
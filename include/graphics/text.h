@@ -0,0 +1,74 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#ifndef TEXT_H
+#define TEXT_H
+
+#include "graphics/renderer.h"
+#include "math/rect2.h"
+#include "math/vector2.h"
+#include <SDL2/SDL.h>
+#include <string>
+#include <vector>
+
+class Font;
+
+struct TextMesh {
+    struct Run {
+        GLuint texture;
+        GLint first;
+        GLsizei count;
+    };
+
+    std::vector<Run> runs;
+    std::vector<Vertex> vertices;
+    double width = 0;
+    double height = 0;
+    Rect2 bounds;
+
+    void clear();
+    void draw(Renderer * renderer, const Vector2 & position) const;
+};
+
+class Text {
+    Font * font;
+    std::string string;
+    SDL_Color color = { 255, 255, 255, 255 };
+    TextMesh mesh;
+    bool dirty = true;
+
+    void update();
+
+public:
+    Text(Font * font, const char * string);
+
+    void set_font(Font * font);
+    void set_string(const char * string);
+    void set_color(SDL_Color color);
+    void draw(Renderer * renderer, const Vector2 & position);
+    Vector2 get_size();
+    Font * get_font() const { return font; }
+    const char * get_string() const { return string.c_str(); }
+};
+
+#endif
\ No newline at end of file
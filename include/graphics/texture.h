@@ -0,0 +1,73 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#ifndef TEXTURE_H
+#define TEXTURE_H
+
+#include "math/rect2.h"
+#include <GL/glew.h>
+#include <SDL2/SDL.h>
+#include <functional>
+#include <string>
+#include <vector>
+
+class Renderer;
+
+bool get_upload_format(const SDL_Surface * surface, GLenum & format, GLenum & type);
+SDL_Surface * prepare_surface(SDL_Surface * surface);
+void begin_upload(const SDL_Surface * surface);
+void end_upload();
+bool read_texture_file(const char * path, std::vector<Uint8> & data);
+
+class Texture {
+    friend class TextureLoader;
+
+    Renderer * renderer;
+    GLuint texture = 0;
+    Rect2 uv = Rect2(0, 0, 1, 1);
+    int width = 0;
+    int height = 0;
+    bool atlased = false;
+    bool ready = false;
+
+    void set_image(SDL_Surface * image);
+    void set_mipmapped_image(SDL_Surface * image, const std::string & cache_path, uint64_t hash);
+    bool load_cached_image(const std::string & cache_path, uint64_t hash);
+
+public:
+    explicit Texture(Renderer * renderer);
+    Texture(Renderer * renderer, const char * path);
+    ~Texture();
+
+    std::function<void(Texture *, bool)> on_ready;
+
+    void draw(const Rect2 & rectangle) const;
+    void draw(const Rect2 & rectangle, const Rect2 & region) const;
+    bool is_ready() const { return ready; }
+    GLuint get_texture() const { return texture; }
+    const Rect2 & get_uv() const { return uv; }
+    int get_width() const { return width; }
+    int get_height() const { return height; }
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,62 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#ifndef TEXTURE_ATLAS_H
+#define TEXTURE_ATLAS_H
+
+#include "graphics/rect_packer.h"
+#include "math/rect2.h"
+#include <GL/glew.h>
+#include <SDL2/SDL.h>
+#include <vector>
+
+#define ATLAS_PAGE_SIZE 2048
+#define ATLAS_MAX_SPRITE_SIZE 512
+
+class RenderDevice;
+
+class TextureAtlas {
+    struct Page {
+        GLuint texture;
+        RectPacker packer;
+        int references;
+        std::vector<SDL_Rect> free_rects;
+        std::vector<SDL_Rect> released;
+    };
+
+    RenderDevice * device;
+    std::vector<Page> pages;
+
+    bool allocate(Page & page, int w, int h, SDL_Rect & rect);
+
+public:
+    explicit TextureAtlas(RenderDevice * device) : device(device) {}
+    ~TextureAtlas();
+
+    bool insert(SDL_Surface * image, GLuint & texture, Rect2 & uv);
+    // The slot becomes available again at the next reclaim, once draws using it are submitted.
+    void release(GLuint texture, const Rect2 & uv);
+    void reclaim();
+};
+
+#endif
\ No newline at end of file
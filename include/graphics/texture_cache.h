@@ -0,0 +1,53 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#ifndef TEXTURE_CACHE_H
+#define TEXTURE_CACHE_H
+
+#include <GL/glew.h>
+#include <SDL2/SDL.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define TEXTURE_CACHE_MAGIC 0x5845544D
+#define TEXTURE_CACHE_VERSION 1
+#define TEXTURE_CACHE_EXTENSION ".mtex"
+
+struct TextureCacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t hash;
+    uint32_t width;
+    uint32_t height;
+    uint32_t format;
+    uint32_t levels;
+};
+
+uint64_t hash_texture_data(const void * data, size_t size);
+
+GLuint load_cached_texture(const char * path, uint64_t hash, int & width, int & height);
+
+GLuint upload_mipmapped_texture(SDL_Surface * image);
+bool save_cached_texture(const char * path, uint64_t hash, GLuint texture, int width, int height);
+
+#endif
\ No newline at end of file
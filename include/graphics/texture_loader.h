@@ -0,0 +1,72 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#ifndef TEXTURE_LOADER_H
+#define TEXTURE_LOADER_H
+
+#include <GL/glew.h>
+#include <SDL2/SDL.h>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <stdint.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define TEXTURE_UPLOAD_BUDGET (4 * 1024 * 1024)
+
+class Texture;
+
+class TextureLoader {
+    struct Job {
+        Texture * texture;
+        std::string path;
+        SDL_Surface * image = nullptr;
+        uint64_t hash = 0;
+        bool cached = false;
+        bool skip_cache = false;
+    };
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::vector<std::thread> workers;
+    std::vector<Texture *> decoding;
+    std::deque<Job> pending;
+    std::deque<Job> decoded;
+    std::deque<Job> uploading;
+    bool quit = false;
+
+    void work(size_t index);
+
+public:
+    TextureLoader();
+    ~TextureLoader();
+
+    void load(Texture * texture, const char * path);
+    void cancel(Texture * texture);
+
+    void update(size_t budget = TEXTURE_UPLOAD_BUDGET);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,71 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#ifndef TILEMAP_H
+#define TILEMAP_H
+
+#include "math/vector2.h"
+#include <GL/glew.h>
+#include <vector>
+
+#define TILEMAP_CHUNK_SIZE 32
+
+class Renderer;
+class Texture;
+
+class TileMap {
+    struct Chunk {
+        GLuint buffer = 0;
+        GLsizei count = 0;
+        bool dirty = true;
+    };
+
+    Renderer * renderer;
+    Texture * tileset;
+    int width;
+    int height;
+    double tile_width;
+    double tile_height;
+    Vector2 position;
+    std::vector<int> tiles;
+    std::vector<Chunk> chunks;
+    int chunks_x;
+    int chunks_y;
+
+    void build_chunk(int chunk_x, int chunk_y);
+
+public:
+    TileMap(Renderer * renderer, Texture * tileset, int width, int height, double tile_width, double tile_height);
+    ~TileMap();
+
+    void set_tile(int x, int y, int tile);
+    int get_tile(int x, int y) const;
+    void set_tileset(Texture * tileset);
+    void set_position(const Vector2 & position);
+    void draw();
+    int get_width() const { return width; }
+    int get_height() const { return height; }
+    const Vector2 & get_position() const { return position; }
+};
+
+#endif
\ No newline at end of file
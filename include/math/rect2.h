@@ -35,6 +35,7 @@ struct Rect2 {
     Rect2(const Vector2 & position, const Vector2 & size);
     Rect2(double x, double y, double width, double height);
 
+    bool intersects(const Rect2 & with) const;
     Rect2 intersect(const Rect2 & with);
     Rect2 union_rect(const Rect2 & with);
 };
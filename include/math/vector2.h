@@ -36,6 +36,12 @@ struct Vector2 {
     double dot(const Vector2 & with);
     double cross(const Vector2 & with);
     Vector2 project(const Vector2 & to);
+
+    void set(double x, double y);
+    void add_in_place(const Vector2 & other);
+    void scale_in_place(double s);
+    void mad(const Vector2 & other, double s);
+    void normalize_in_place();
 };
 
 #endif
\ No newline at end of file
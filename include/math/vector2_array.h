@@ -0,0 +1,63 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#ifndef VECTOR2_ARRAY_H
+#define VECTOR2_ARRAY_H
+
+#include "rect2.h"
+#include "vector2.h"
+#include <stddef.h>
+#include <vector>
+
+class Vector2Array {
+    std::vector<double> storage;
+    double * xs;
+    double * ys;
+    size_t count;
+    bool attached = false;
+
+public:
+    explicit Vector2Array(size_t count = 0);
+
+    void attach(void * data, size_t count);
+    bool is_attached() const { return attached; }
+    void resize(size_t count);
+    size_t size() const { return count; }
+    const double * get_xs() const { return xs; }
+    const double * get_ys() const { return ys; }
+
+    Vector2 get(size_t index) const { return Vector2(xs[index], ys[index]); }
+    void set(size_t index, const Vector2 & value);
+    void fill(const Vector2 & value);
+    void add(const Vector2 & offset);
+    void add(const Vector2Array & other);
+    void scale(double s);
+    void mad(const Vector2Array & other, double s);
+    void normalize();
+    void get_lengths(double * lengths) const;
+    void clamp(const Rect2 & rect);
+    long nearest(const Vector2 & point) const;
+    void find_within(const Vector2 & point, double radius, std::vector<size_t> & indices) const;
+};
+
+#endif
\ No newline at end of file
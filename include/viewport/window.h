@@ -30,17 +30,20 @@
 
 class Window {
     SDL_Window * window;
-    SDL_GLContext context;
+    SDL_GLContext context = nullptr;
     bool quit = false;
 
+    void create_context();
+
 public:
-    Window(const char * title, int w, int h, const char * icon_path = nullptr, bool resizable = false, bool always_on_top = false, bool borderless = false, bool fullscreen = false);
+    Window(const char * title, int w, int h, const char * icon_path = nullptr, bool resizable = false, bool always_on_top = false, bool borderless = false, bool fullscreen = false, bool opengl = true);
     ~Window();
 
     void swap();
     bool should_close() const { return quit; }
     void close_window() { quit = true; }
     SDL_Window * get_window() const { return window; }
+    SDL_GLContext get_context() const { return context; }
 };
 
 #endif
\ No newline at end of file
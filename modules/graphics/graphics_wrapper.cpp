@@ -22,59 +22,37 @@
 /******************************************************************************/
 
 #include "graphics_wrapper.h"
+#include "engine.h"
+#include "graphics/camera2d.h"
 #include "graphics/font.h"
+#include "graphics/particle_emitter.h"
+#include "graphics/render_target.h"
+#include "graphics/text.h"
+#include "graphics/texture.h"
+#include "graphics/tilemap.h"
 #include "math/rect2.h"
 #include "math/vector2.h"
+#include "modules/math/math_wrapper.h"
 #include <GL/glew.h>
-#include <math.h>
-
-static Font * default_font = new Font("/usr/share/fonts/noto/NotoSans-Condensed.ttf", 12);
-
-GLuint load_texture(SDL_Surface * surface) {
-    SDL_Surface * image = SDL_CreateRGBSurface(0, surface->w, surface->h, 32, 0x000000FF, 0x0000FF00, 0x00FF0000, 0xFF000000);
-    Uint8 alpha;
-    SDL_BlendMode blend;
-    SDL_GetSurfaceAlphaMod(surface, &alpha);
-    SDL_SetSurfaceAlphaMod(surface, 0xFF);
-    SDL_GetSurfaceBlendMode(surface, &blend);
-    SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_NONE);
-    SDL_Rect area = { 0, 0, surface->w, surface->h };
-    SDL_BlitSurface(surface, &area, image, &area);
-    SDL_SetSurfaceAlphaMod(surface, alpha);
-    SDL_SetSurfaceBlendMode(surface, blend);
-    GLuint texture;
-    glGenTextures(1, &texture);
-    glBindTexture(GL_TEXTURE_2D, texture);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, surface->w, surface->h, 0, GL_RGBA, GL_UNSIGNED_BYTE, image->pixels);
-    SDL_FreeSurface(image);
-    return texture;
+#include <sqstdblob.h>
+#include <vector>
+
+static Font * get_default_font() {
+    Renderer * renderer = Engine::get_singleton()->get_renderer();
+    return renderer != nullptr ? renderer->get_fonts()->get_default_font() : nullptr;
 }
 
 static SQInteger squirrel_graphics_fillrectangle(HSQUIRRELVM v) {
     Rect2 * rectangle;
     sq_getinstanceup(v, 2, (SQUserPointer *)&rectangle, (SQUserPointer)"Rect2Tag", SQTrue);
-    glBegin(GL_QUADS);
-    glVertex2d(rectangle->position.x, rectangle->position.y);
-    glVertex2d(rectangle->position.x + rectangle->size.x, rectangle->position.y);
-    glVertex2d(rectangle->position.x + rectangle->size.x, rectangle->position.y + rectangle->size.y);
-    glVertex2d(rectangle->position.x, rectangle->position.y + rectangle->size.y);
-    glEnd();
-    glFlush();
+    Engine::get_singleton()->get_renderer()->fill_rectangle(*rectangle);
     return 0;
 }
 
 static SQInteger squirrel_graphics_drawrectangle(HSQUIRRELVM v) {
     Rect2 * rectangle;
     sq_getinstanceup(v, 2, (SQUserPointer *)&rectangle, (SQUserPointer)"Rect2Tag", SQTrue);
-    glBegin(GL_LINE_LOOP);
-    glVertex2d(rectangle->position.x, rectangle->position.y);
-    glVertex2d(rectangle->position.x + rectangle->size.x, rectangle->position.y);
-    glVertex2d(rectangle->position.x + rectangle->size.x, rectangle->position.y + rectangle->size.y);
-    glVertex2d(rectangle->position.x, rectangle->position.y + rectangle->size.y);
-    glEnd();
-    glFlush();
+    Engine::get_singleton()->get_renderer()->draw_rectangle(*rectangle);
     return 0;
 }
 
@@ -85,14 +63,7 @@ static SQInteger squirrel_graphics_fillcircle(HSQUIRRELVM v) {
     if(SQ_FAILED(sq_getfloat(v, 3, &radius)))
         return sq_throwerror(v, _SC("Argument 2 not a float"));
     
-    glBegin(GL_TRIANGLE_FAN);
-    for(int i = 0; i <= 500; i++) {
-        double angle = 2 * M_PI * i / 500;
-        glVertex2d(position->x + cos(angle) * radius, position->y + sin(angle) * radius);
-    }
-
-    glEnd();
-    glFlush();
+    Engine::get_singleton()->get_renderer()->fill_circle(*position, radius);
     return 0;
 }
 
@@ -103,14 +74,7 @@ static SQInteger squirrel_graphics_drawcircle(HSQUIRRELVM v) {
     if(SQ_FAILED(sq_getfloat(v, 3, &radius)))
         return sq_throwerror(v, _SC("Argument 2 not a float"));
     
-    glBegin(GL_LINE_LOOP);
-    for(int i = 0; i <= 500; i++) {
-        double angle = 2 * M_PI * i / 500;
-        glVertex2d(position->x + cos(angle) * radius, position->y + sin(angle) * radius);
-    }
-
-    glEnd();
-    glFlush();
+    Engine::get_singleton()->get_renderer()->draw_circle(*position, radius);
     return 0;
 }
 
@@ -119,70 +83,1478 @@ static SQInteger squirrel_graphics_drawline(HSQUIRRELVM v) {
     Vector2 * end;
     sq_getinstanceup(v, 2, (SQUserPointer *)&start, (SQUserPointer)"Vector2Tag", SQTrue);
     sq_getinstanceup(v, 3, (SQUserPointer *)&end, (SQUserPointer)"Vector2Tag", SQTrue);
-    glBegin(GL_LINES);
-    glVertex2d(start->x, start->y);
-    glVertex2d(end->x, end->y);
-    glEnd();
-    glFlush();
+    Engine::get_singleton()->get_renderer()->draw_line(*start, *end);
     return 0;
 }
 
 static SQInteger squirrel_graphics_drawtext(HSQUIRRELVM v) {
     const SQChar * text;
     Vector2 * position;
-    Font * font = default_font;
+    Font * font = nullptr;
     if(SQ_FAILED(sq_getstring(v, 2, &text)))
         return sq_throwerror(v, _SC("Argument 1 not a string"));
     
     sq_getinstanceup(v, 3, (SQUserPointer *)&position, (SQUserPointer)"Vector2Tag", SQTrue);
     if(sq_gettop(v) > 3)
         sq_getinstanceup(v, 4, (SQUserPointer *)&font, (SQUserPointer)"FontTag", SQTrue);
+    else if((font = get_default_font()) == nullptr)
+        return sq_throwerror(v, _SC("Unable to load the default font"));
     
-    SDL_Surface * surface = TTF_RenderUTF8_Blended(font->get_font(), text, { 255, 255, 255 });
-    SDL_FRect rect = { (float)position->x, (float)position->y, (float)(position->x + surface->w), (float)(position->y + surface->h) };
-    GLuint texture = load_texture(surface);
-    SDL_FreeSurface(surface);
-    glBindTexture(GL_TEXTURE_2D, texture);
-    glBegin(GL_QUADS);
-    glTexCoord2d(0, 0); glVertex2d(rect.x, rect.y);
-    glTexCoord2d(0, 1); glVertex2d(rect.x, rect.h);
-    glTexCoord2d(1, 1); glVertex2d(rect.w, rect.h);
-    glTexCoord2d(1, 0); glVertex2d(rect.w, rect.y);
-    glEnd();
-    glFlush();
-    glBindTexture(GL_TEXTURE_2D, 0);
-    glDeleteTextures(1, &texture);
+    font->draw_text(Engine::get_singleton()->get_renderer(), text, *position);
     return 0;
 }
 
-void register_graphics_wrapper(HSQUIRRELVM v) {
-    sq_pushstring(v, _SC("fill_rectangle"), -1);
-    sq_newclosure(v, squirrel_graphics_fillrectangle, 0);
-    sq_setparamscheck(v, 2, _SC(".x"));
-    sq_newslot(v, -3, SQFalse);
+static SQInteger squirrel_graphics_measuretext(HSQUIRRELVM v) {
+    const SQChar * text;
+    Font * font = nullptr;
+    if(SQ_FAILED(sq_getstring(v, 2, &text)))
+        return sq_throwerror(v, _SC("Argument 1 not a string"));
+    
+    if(sq_gettop(v) > 2) {
+        if(SQ_FAILED(sq_getinstanceup(v, 3, (SQUserPointer *)&font, (SQUserPointer)"FontTag", SQTrue)))
+            return SQ_ERROR;
+    } else if((font = get_default_font()) == nullptr)
+        return sq_throwerror(v, _SC("Unable to load the default font"));
+    
+    push_vector2(v, font->measure_text(text));
+    return 1;
+}
 
-    sq_pushstring(v, _SC("draw_rectangle"), -1);
-    sq_newclosure(v, squirrel_graphics_drawrectangle, 0);
-    sq_setparamscheck(v, 2, _SC(".x"));
-    sq_newslot(v, -3, SQFalse);
+static SQInteger squirrel_graphics_layouttext(HSQUIRRELVM v) {
+    const SQChar * text;
+    SQFloat max_width;
+    SQInteger align = ALIGN_LEFT;
+    Font * font = nullptr;
+    if(SQ_FAILED(sq_getstring(v, 2, &text)))
+        return sq_throwerror(v, _SC("Argument 1 not a string"));
+    
+    if(SQ_FAILED(sq_getfloat(v, 3, &max_width)))
+        return sq_throwerror(v, _SC("Argument 2 not a float"));
+    
+    if(sq_gettop(v) > 3 && SQ_FAILED(sq_getinteger(v, 4, &align)))
+        return sq_throwerror(v, _SC("Argument 3 not an integer"));
+    
+    if(align < ALIGN_LEFT || align > ALIGN_RIGHT)
+        return sq_throwerror(v, _SC("Invalid text alignment"));
+    
+    if(sq_gettop(v) > 4) {
+        if(SQ_FAILED(sq_getinstanceup(v, 5, (SQUserPointer *)&font, (SQUserPointer)"FontTag", SQTrue)))
+            return SQ_ERROR;
+    } else if((font = get_default_font()) == nullptr)
+        return sq_throwerror(v, _SC("Unable to load the default font"));
+    
+    std::vector<TextLine> lines;
+    font->layout_text(text, max_width, (TextAlign)align, lines);
+    sq_newarray(v, 0);
+    for(const TextLine & line : lines) {
+        sq_newtable(v);
+        sq_pushstring(v, _SC("text"), -1);
+        sq_pushstring(v, text + line.start, line.length);
+        sq_newslot(v, -3, SQFalse);
+        sq_pushstring(v, _SC("x"), -1);
+        sq_pushfloat(v, line.x);
+        sq_newslot(v, -3, SQFalse);
+        sq_pushstring(v, _SC("y"), -1);
+        sq_pushfloat(v, line.y);
+        sq_newslot(v, -3, SQFalse);
+        sq_pushstring(v, _SC("width"), -1);
+        sq_pushfloat(v, line.width);
+        sq_newslot(v, -3, SQFalse);
+        sq_arrayappend(v, -2);
+    }
 
-    sq_pushstring(v, _SC("fill_circle"), -1);
-    sq_newclosure(v, squirrel_graphics_fillcircle, 0);
-    sq_setparamscheck(v, 3, _SC(".xn"));
-    sq_newslot(v, -3, SQFalse);
+    return 1;
+}
 
-    sq_pushstring(v, _SC("draw_circle"), -1);
-    sq_newclosure(v, squirrel_graphics_drawcircle, 0);
-    sq_setparamscheck(v, 3, _SC(".xn"));
-    sq_newslot(v, -3, SQFalse);
+static SQInteger squirrel_graphics_fillrectangles(HSQUIRRELVM v) {
+    Renderer * renderer = Engine::get_singleton()->get_renderer();
+    if(renderer == nullptr)
+        return sq_throwerror(v, _SC("Renderer not initialized"));
+    
+    if(sq_gettype(v, 2) == OT_ARRAY) {
+        std::vector<RectangleInstance> instances;
+        instances.reserve(sq_getsize(v, 2));
+        sq_pushnull(v);
+        while(SQ_SUCCEEDED(sq_next(v, 2))) {
+            Rect2 * rectangle;
+            if(SQ_FAILED(sq_getinstanceup(v, -1, (SQUserPointer *)&rectangle, (SQUserPointer)"Rect2Tag", SQTrue)))
+                return SQ_ERROR;
+            
+            instances.push_back({ (float)rectangle->position.x, (float)rectangle->position.y, (float)rectangle->size.x, (float)rectangle->size.y, 1, 1, 1, 1 });
+            sq_pop(v, 2);
+        }
 
-    sq_pushstring(v, _SC("draw_line"), -1);
-    sq_newclosure(v, squirrel_graphics_drawline, 0);
-    sq_setparamscheck(v, 3, _SC(".xx"));
-    sq_newslot(v, -3, SQFalse);
+        sq_pop(v, 1);
+        renderer->fill_rectangles(instances.data(), instances.size());
+        return 0;
+    }
+
+    SQUserPointer data;
+    if(SQ_FAILED(sqstd_getblob(v, 2, &data)))
+        return sq_throwerror(v, _SC("Argument 1 not an array or a blob"));
+    
+    renderer->fill_rectangles((const RectangleInstance *)data, sqstd_getblobsize(v, 2) / sizeof(RectangleInstance));
+    return 0;
+}
+
+static SQInteger squirrel_graphics_drawmany(HSQUIRRELVM v) {
+    Texture * texture;
+    if(SQ_FAILED(sq_getinstanceup(v, 2, (SQUserPointer *)&texture, (SQUserPointer)"TextureTag", SQTrue)))
+        return SQ_ERROR;
+    
+    SQUserPointer data;
+    if(SQ_FAILED(sqstd_getblob(v, 3, &data)))
+        return sq_throwerror(v, _SC("Argument 2 not a blob"));
+    
+    Renderer * renderer = Engine::get_singleton()->get_renderer();
+    if(renderer == nullptr)
+        return sq_throwerror(v, _SC("Renderer not initialized"));
+    
+    if(texture->is_ready())
+        renderer->draw_sprites(texture->get_texture(), texture->get_uv(), texture->get_width(), texture->get_height(), (const SpriteInstance *)data, sqstd_getblobsize(v, 3) / sizeof(SpriteInstance));
+    
+    return 0;
+}
+
+static SQInteger squirrel_graphics_setlayer(HSQUIRRELVM v) {
+    SQInteger layer;
+    if(SQ_FAILED(sq_getinteger(v, 2, &layer)))
+        return sq_throwerror(v, _SC("Argument 1 not an integer"));
+    
+    if(layer < 0 || layer >= RENDERER_MAX_LAYERS)
+        return sq_throwerror(v, _SC("Layer out of range"));
+    
+    Engine::get_singleton()->get_renderer()->set_layer(layer);
+    return 0;
+}
+
+static SQInteger squirrel_graphics_setlayersorted(HSQUIRRELVM v) {
+    SQInteger layer;
+    SQBool sorted;
+    if(SQ_FAILED(sq_getinteger(v, 2, &layer)))
+        return sq_throwerror(v, _SC("Argument 1 not an integer"));
+    
+    if(SQ_FAILED(sq_getbool(v, 3, &sorted)))
+        return sq_throwerror(v, _SC("Argument 2 not a bool"));
+    
+    if(layer < 0 || layer >= RENDERER_MAX_LAYERS)
+        return sq_throwerror(v, _SC("Layer out of range"));
+    
+    Engine::get_singleton()->get_renderer()->set_layer_sorted(layer, sorted);
+    return 0;
+}
+
+static SQInteger squirrel_graphics_setblendmode(HSQUIRRELVM v) {
+    SQInteger blend;
+    if(SQ_FAILED(sq_getinteger(v, 2, &blend)))
+        return sq_throwerror(v, _SC("Argument 1 not an integer"));
+    
+    if(blend < 0 || blend >= BLEND_MAX)
+        return sq_throwerror(v, _SC("Argument 1 not a blend mode"));
+    
+    Engine::get_singleton()->get_renderer()->set_blend_mode((BlendMode)blend);
+    return 0;
+}
+
+static SQInteger squirrel_graphics_setdepth(HSQUIRRELVM v) {
+    SQInteger depth;
+    if(SQ_FAILED(sq_getinteger(v, 2, &depth)))
+        return sq_throwerror(v, _SC("Argument 1 not an integer"));
+    
+    if(depth < 0 || depth > 0xFFFF)
+        return sq_throwerror(v, _SC("Depth out of range"));
+    
+    Engine::get_singleton()->get_renderer()->set_depth(depth);
+    return 0;
+}
+
+SQInteger squirrel_font_destructor(SQUserPointer p, SQInteger SQ_UNUSED_ARG(size)) {
+    Font * instance = reinterpret_cast<Font *>(p);
+    Engine::get_singleton()->get_renderer()->get_fonts()->release(instance);
+    return 0;
+}
+
+static SQInteger squirrel_font_constructor(HSQUIRRELVM v) {
+    const SQChar * path;
+    SQInteger size;
+    if(SQ_FAILED(sq_getstring(v, 2, &path)))
+        return sq_throwerror(v, _SC("Argument 1 not a string"));
+    
+    if(SQ_FAILED(sq_getinteger(v, 3, &size)))
+        return sq_throwerror(v, _SC("Argument 2 not an integer"));
+    
+    SQBool sdf = SQFalse;
+    if(sq_gettop(v) > 3 && SQ_FAILED(sq_getbool(v, 4, &sdf)))
+        return sq_throwerror(v, _SC("Argument 3 not a bool"));
+    
+    if(size <= 0)
+        return sq_throwerror(v, _SC("Font size must be positive"));
+    
+    Renderer * renderer = Engine::get_singleton()->get_renderer();
+    if(renderer == nullptr)
+        return sq_throwerror(v, _SC("Renderer not initialized"));
+    
+    Font * instance = renderer->get_fonts()->acquire(path, size, sdf);
+    if(instance == nullptr)
+        return sq_throwerror(v, _SC("Unable to load the font"));
+    
+    sq_setinstanceup(v, 1, instance);
+    sq_setreleasehook(v, 1, squirrel_font_destructor);
+    return 0;
+}
+
+SQInteger squirrel_text_destructor(SQUserPointer p, SQInteger SQ_UNUSED_ARG(size)) {
+    Text * instance = reinterpret_cast<Text *>(p);
+    delete instance;
+    return 0;
+}
+
+static SQInteger squirrel_text_constructor(HSQUIRRELVM v) {
+    const SQChar * string;
+    Font * font = nullptr;
+    if(SQ_FAILED(sq_getstring(v, 2, &string)))
+        return sq_throwerror(v, _SC("Argument 1 not a string"));
+    
+    if(sq_gettop(v) > 2) {
+        if(SQ_FAILED(sq_getinstanceup(v, 3, (SQUserPointer *)&font, (SQUserPointer)"FontTag", SQTrue)))
+            return SQ_ERROR;
+        
+        sq_pushstring(v, _SC("_font"), -1);
+        sq_push(v, 3);
+        sq_set(v, 1);
+    } else if((font = get_default_font()) == nullptr)
+        return sq_throwerror(v, _SC("Unable to load the default font"));
+
+    Text * instance = new Text(font, string);
+    sq_setinstanceup(v, 1, instance);
+    sq_setreleasehook(v, 1, squirrel_text_destructor);
+    return 0;
+}
+
+static SQInteger squirrel_text_setstring(HSQUIRRELVM v) {
+    Text * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"TextTag", SQTrue);
+    const SQChar * string;
+    if(SQ_FAILED(sq_getstring(v, 2, &string)))
+        return sq_throwerror(v, _SC("Argument 1 not a string"));
+    
+    instance->set_string(string);
+    return 0;
+}
+
+static SQInteger squirrel_text_getstring(HSQUIRRELVM v) {
+    Text * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"TextTag", SQTrue);
+    sq_pushstring(v, instance->get_string(), -1);
+    return 1;
+}
+
+static SQInteger squirrel_text_setfont(HSQUIRRELVM v) {
+    Text * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"TextTag", SQTrue);
+    Font * font;
+    if(SQ_FAILED(sq_getinstanceup(v, 2, (SQUserPointer *)&font, (SQUserPointer)"FontTag", SQTrue)))
+        return SQ_ERROR;
+    
+    sq_pushstring(v, _SC("_font"), -1);
+    sq_push(v, 2);
+    sq_set(v, 1);
+    instance->set_font(font);
+    return 0;
+}
+
+static SQInteger squirrel_text_setcolor(HSQUIRRELVM v) {
+    Text * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"TextTag", SQTrue);
+    SQInteger r, g, b, a = 255;
+    if(SQ_FAILED(sq_getinteger(v, 2, &r)))
+        return sq_throwerror(v, _SC("Argument 1 not an integer"));
+    
+    if(SQ_FAILED(sq_getinteger(v, 3, &g)))
+        return sq_throwerror(v, _SC("Argument 2 not an integer"));
+    
+    if(SQ_FAILED(sq_getinteger(v, 4, &b)))
+        return sq_throwerror(v, _SC("Argument 3 not an integer"));
+    
+    if(sq_gettop(v) > 4 && SQ_FAILED(sq_getinteger(v, 5, &a)))
+        return sq_throwerror(v, _SC("Argument 4 not an integer"));
+    
+    instance->set_color({ (Uint8)r, (Uint8)g, (Uint8)b, (Uint8)a });
+    return 0;
+}
+
+static SQInteger squirrel_text_getsize(HSQUIRRELVM v) {
+    Text * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"TextTag", SQTrue);
+    push_vector2(v, instance->get_size());
+    return 1;
+}
+
+static SQInteger squirrel_text_draw(HSQUIRRELVM v) {
+    Text * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"TextTag", SQTrue);
+    Vector2 * position;
+    sq_getinstanceup(v, 2, (SQUserPointer *)&position, (SQUserPointer)"Vector2Tag", SQTrue);
+    instance->draw(Engine::get_singleton()->get_renderer(), *position);
+    return 0;
+}
+
+SQInteger squirrel_texture_destructor(SQUserPointer p, SQInteger SQ_UNUSED_ARG(size)) {
+    Texture * instance = reinterpret_cast<Texture *>(p);
+    delete instance;
+    return 0;
+}
+
+static SQInteger squirrel_texture_constructor(HSQUIRRELVM v) {
+    const SQChar * path;
+    if(SQ_FAILED(sq_getstring(v, 2, &path)))
+        return sq_throwerror(v, _SC("Argument 1 not a string"));
+    
+    Renderer * renderer = Engine::get_singleton()->get_renderer();
+    if(renderer == nullptr)
+        return sq_throwerror(v, _SC("Renderer not initialized"));
+    
+    Texture * instance = new Texture(renderer, path);
+    sq_setinstanceup(v, 1, instance);
+    sq_setreleasehook(v, 1, squirrel_texture_destructor);
+    return 0;
+}
+
+static SQInteger squirrel_texture_loadasync(HSQUIRRELVM v) {
+    const SQChar * path;
+    if(SQ_FAILED(sq_getstring(v, 2, &path)))
+        return sq_throwerror(v, _SC("Argument 1 not a string"));
+    
+    Renderer * renderer = Engine::get_singleton()->get_renderer();
+    if(renderer == nullptr)
+        return sq_throwerror(v, _SC("Renderer not initialized"));
+    
+    Texture * instance = new Texture(renderer);
+    sq_createinstance(v, 1);
+    sq_setinstanceup(v, -1, instance);
+    sq_setreleasehook(v, -1, squirrel_texture_destructor);
+    HSQOBJECT object;
+    HSQOBJECT callback;
+    sq_resetobject(&callback);
+    sq_getstackobj(v, -1, &object);
+    sq_addref(v, &object);
+    if(sq_gettop(v) > 3) {
+        sq_getstackobj(v, 3, &callback);
+        sq_addref(v, &callback);
+    }
+
+    instance->on_ready = [v, object, callback](Texture *, bool success) mutable {
+        if(!sq_isnull(callback)) {
+            sq_pushobject(v, callback);
+            sq_pushroottable(v);
+            sq_pushobject(v, object);
+            sq_pushbool(v, success);
+            sq_call(v, 3, SQFalse, SQTrue);
+            sq_pop(v, 1);
+            sq_release(v, &callback);
+        }
+
+        sq_release(v, &object);
+    };
+    renderer->get_loader()->load(instance, path);
+    return 1;
+}
+
+static SQInteger squirrel_texture_isready(HSQUIRRELVM v) {
+    Texture * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"TextureTag", SQTrue);
+    sq_pushbool(v, instance->is_ready());
+    return 1;
+}
+
+static SQInteger squirrel_texture_draw(HSQUIRRELVM v) {
+    Texture * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"TextureTag", SQTrue);
+    Vector2 * position;
+    sq_getinstanceup(v, 2, (SQUserPointer *)&position, (SQUserPointer)"Vector2Tag", SQTrue);
+    instance->draw(Rect2(position->x, position->y, instance->get_width(), instance->get_height()));
+    return 0;
+}
+
+static SQInteger squirrel_texture_drawrect(HSQUIRRELVM v) {
+    Texture * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"TextureTag", SQTrue);
+    Rect2 * rectangle;
+    sq_getinstanceup(v, 2, (SQUserPointer *)&rectangle, (SQUserPointer)"Rect2Tag", SQTrue);
+    if(sq_gettop(v) > 2) {
+        Rect2 * region;
+        sq_getinstanceup(v, 3, (SQUserPointer *)&region, (SQUserPointer)"Rect2Tag", SQTrue);
+        instance->draw(*rectangle, *region);
+    } else
+        instance->draw(*rectangle);
+    
+    return 0;
+}
+
+static SQInteger squirrel_texture_getsize(HSQUIRRELVM v) {
+    Texture * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"TextureTag", SQTrue);
+    push_vector2(v, instance->get_width(), instance->get_height());
+    return 1;
+}
+
+SQInteger squirrel_tilemap_destructor(SQUserPointer p, SQInteger SQ_UNUSED_ARG(size)) {
+    TileMap * instance = reinterpret_cast<TileMap *>(p);
+    delete instance;
+    return 0;
+}
+
+static SQInteger squirrel_tilemap_constructor(HSQUIRRELVM v) {
+    Texture * tileset;
+    SQInteger width, height;
+    SQFloat tile_width, tile_height;
+    if(SQ_FAILED(sq_getinstanceup(v, 2, (SQUserPointer *)&tileset, (SQUserPointer)"TextureTag", SQTrue)))
+        return SQ_ERROR;
+    
+    if(SQ_FAILED(sq_getinteger(v, 3, &width)))
+        return sq_throwerror(v, _SC("Argument 2 not an integer"));
+    
+    if(SQ_FAILED(sq_getinteger(v, 4, &height)))
+        return sq_throwerror(v, _SC("Argument 3 not an integer"));
+    
+    if(SQ_FAILED(sq_getfloat(v, 5, &tile_width)))
+        return sq_throwerror(v, _SC("Argument 4 not a float"));
+    
+    if(SQ_FAILED(sq_getfloat(v, 6, &tile_height)))
+        return sq_throwerror(v, _SC("Argument 5 not a float"));
+    
+    if(width <= 0 || height <= 0 || tile_width <= 0 || tile_height <= 0)
+        return sq_throwerror(v, _SC("Tile map dimensions must be positive"));
+    
+    Renderer * renderer = Engine::get_singleton()->get_renderer();
+    if(renderer == nullptr)
+        return sq_throwerror(v, _SC("Renderer not initialized"));
+    
+    sq_pushstring(v, _SC("_tileset"), -1);
+    sq_push(v, 2);
+    sq_set(v, 1);
+    TileMap * instance = new TileMap(renderer, tileset, width, height, tile_width, tile_height);
+    sq_setinstanceup(v, 1, instance);
+    sq_setreleasehook(v, 1, squirrel_tilemap_destructor);
+    return 0;
+}
+
+static SQInteger squirrel_tilemap_settile(HSQUIRRELVM v) {
+    TileMap * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"TileMapTag", SQTrue);
+    SQInteger x, y, tile;
+    if(SQ_FAILED(sq_getinteger(v, 2, &x)))
+        return sq_throwerror(v, _SC("Argument 1 not an integer"));
+    
+    if(SQ_FAILED(sq_getinteger(v, 3, &y)))
+        return sq_throwerror(v, _SC("Argument 2 not an integer"));
+    
+    if(SQ_FAILED(sq_getinteger(v, 4, &tile)))
+        return sq_throwerror(v, _SC("Argument 3 not an integer"));
+    
+    instance->set_tile(x, y, tile);
+    return 0;
+}
+
+static SQInteger squirrel_tilemap_gettile(HSQUIRRELVM v) {
+    TileMap * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"TileMapTag", SQTrue);
+    SQInteger x, y;
+    if(SQ_FAILED(sq_getinteger(v, 2, &x)))
+        return sq_throwerror(v, _SC("Argument 1 not an integer"));
+    
+    if(SQ_FAILED(sq_getinteger(v, 3, &y)))
+        return sq_throwerror(v, _SC("Argument 2 not an integer"));
+    
+    sq_pushinteger(v, instance->get_tile(x, y));
+    return 1;
+}
+
+static SQInteger squirrel_tilemap_settileset(HSQUIRRELVM v) {
+    TileMap * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"TileMapTag", SQTrue);
+    Texture * tileset;
+    if(SQ_FAILED(sq_getinstanceup(v, 2, (SQUserPointer *)&tileset, (SQUserPointer)"TextureTag", SQTrue)))
+        return SQ_ERROR;
+    
+    sq_pushstring(v, _SC("_tileset"), -1);
+    sq_push(v, 2);
+    sq_set(v, 1);
+    instance->set_tileset(tileset);
+    return 0;
+}
+
+static SQInteger squirrel_tilemap_setposition(HSQUIRRELVM v) {
+    TileMap * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"TileMapTag", SQTrue);
+    Vector2 * position;
+    sq_getinstanceup(v, 2, (SQUserPointer *)&position, (SQUserPointer)"Vector2Tag", SQTrue);
+    instance->set_position(*position);
+    return 0;
+}
+
+static SQInteger squirrel_tilemap_draw(HSQUIRRELVM v) {
+    TileMap * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"TileMapTag", SQTrue);
+    instance->draw();
+    return 0;
+}
+
+SQInteger squirrel_particleemitter_destructor(SQUserPointer p, SQInteger SQ_UNUSED_ARG(size)) {
+    ParticleEmitter * instance = reinterpret_cast<ParticleEmitter *>(p);
+    delete instance;
+    return 0;
+}
+
+static SQInteger squirrel_particleemitter_constructor(HSQUIRRELVM v) {
+    SQInteger capacity = 10000;
+    if(sq_gettop(v) > 1 && SQ_FAILED(sq_getinteger(v, 2, &capacity)))
+        return sq_throwerror(v, _SC("Argument 1 not an integer"));
+    
+    if(capacity <= 0)
+        return sq_throwerror(v, _SC("Particle capacity must be positive"));
+    
+    ParticleEmitter * instance = new ParticleEmitter(capacity);
+    sq_setinstanceup(v, 1, instance);
+    sq_setreleasehook(v, 1, squirrel_particleemitter_destructor);
+    return 0;
+}
+
+static SQInteger squirrel_particleemitter_settexture(HSQUIRRELVM v) {
+    ParticleEmitter * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"ParticleEmitterTag", SQTrue);
+    Texture * texture = nullptr;
+    if(sq_gettype(v, 2) != OT_NULL && SQ_FAILED(sq_getinstanceup(v, 2, (SQUserPointer *)&texture, (SQUserPointer)"TextureTag", SQTrue)))
+        return SQ_ERROR;
+    
+    sq_pushstring(v, _SC("_texture"), -1);
+    sq_push(v, 2);
+    sq_set(v, 1);
+    instance->set_texture(texture);
+    return 0;
+}
+
+static SQInteger squirrel_particleemitter_setposition(HSQUIRRELVM v) {
+    ParticleEmitter * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"ParticleEmitterTag", SQTrue);
+    Vector2 * position;
+    sq_getinstanceup(v, 2, (SQUserPointer *)&position, (SQUserPointer)"Vector2Tag", SQTrue);
+    instance->set_position(*position);
+    return 0;
+}
+
+static SQInteger squirrel_particleemitter_setgravity(HSQUIRRELVM v) {
+    ParticleEmitter * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"ParticleEmitterTag", SQTrue);
+    Vector2 * gravity;
+    sq_getinstanceup(v, 2, (SQUserPointer *)&gravity, (SQUserPointer)"Vector2Tag", SQTrue);
+    instance->set_gravity(*gravity);
+    return 0;
+}
+
+static SQInteger squirrel_particleemitter_setrate(HSQUIRRELVM v) {
+    ParticleEmitter * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"ParticleEmitterTag", SQTrue);
+    SQFloat rate;
+    if(SQ_FAILED(sq_getfloat(v, 2, &rate)))
+        return sq_throwerror(v, _SC("Argument 1 not a float"));
+    
+    instance->set_rate(rate);
+    return 0;
+}
+
+static SQInteger squirrel_particleemitter_setlifetime(HSQUIRRELVM v) {
+    ParticleEmitter * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"ParticleEmitterTag", SQTrue);
+    SQFloat min, max;
+    if(SQ_FAILED(sq_getfloat(v, 2, &min)))
+        return sq_throwerror(v, _SC("Argument 1 not a float"));
+    
+    if(SQ_FAILED(sq_getfloat(v, 3, &max)))
+        return sq_throwerror(v, _SC("Argument 2 not a float"));
+    
+    instance->set_lifetime(min, max);
+    return 0;
+}
+
+static SQInteger squirrel_particleemitter_setspeed(HSQUIRRELVM v) {
+    ParticleEmitter * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"ParticleEmitterTag", SQTrue);
+    SQFloat min, max;
+    if(SQ_FAILED(sq_getfloat(v, 2, &min)))
+        return sq_throwerror(v, _SC("Argument 1 not a float"));
+    
+    if(SQ_FAILED(sq_getfloat(v, 3, &max)))
+        return sq_throwerror(v, _SC("Argument 2 not a float"));
+    
+    instance->set_speed(min, max);
+    return 0;
+}
+
+static SQInteger squirrel_particleemitter_setdirection(HSQUIRRELVM v) {
+    ParticleEmitter * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"ParticleEmitterTag", SQTrue);
+    SQFloat direction, spread;
+    if(SQ_FAILED(sq_getfloat(v, 2, &direction)))
+        return sq_throwerror(v, _SC("Argument 1 not a float"));
+    
+    if(SQ_FAILED(sq_getfloat(v, 3, &spread)))
+        return sq_throwerror(v, _SC("Argument 2 not a float"));
+    
+    instance->set_direction(direction, spread);
+    return 0;
+}
+
+static SQInteger squirrel_particleemitter_setsizes(HSQUIRRELVM v) {
+    ParticleEmitter * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"ParticleEmitterTag", SQTrue);
+    SQFloat start, end;
+    if(SQ_FAILED(sq_getfloat(v, 2, &start)))
+        return sq_throwerror(v, _SC("Argument 1 not a float"));
+    
+    if(SQ_FAILED(sq_getfloat(v, 3, &end)))
+        return sq_throwerror(v, _SC("Argument 2 not a float"));
+    
+    instance->set_sizes(start, end);
+    return 0;
+}
+
+static SQInteger get_particle_color(HSQUIRRELVM v, SQFloat color[4]) {
+    color[3] = 1;
+    SQInteger count = sq_gettop(v) > 5 ? 4 : 3;
+    for(SQInteger i = 0; i < count; i++) {
+        if(SQ_FAILED(sq_getfloat(v, i + 2, &color[i])))
+            return SQ_ERROR;
+    }
+
+    return SQ_OK;
+}
+
+static SQInteger squirrel_particleemitter_setstartcolor(HSQUIRRELVM v) {
+    ParticleEmitter * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"ParticleEmitterTag", SQTrue);
+    SQFloat color[4];
+    if(SQ_FAILED(get_particle_color(v, color)))
+        return sq_throwerror(v, _SC("Color components must be floats"));
+    
+    instance->set_start_color(color[0], color[1], color[2], color[3]);
+    return 0;
+}
+
+static SQInteger squirrel_particleemitter_setendcolor(HSQUIRRELVM v) {
+    ParticleEmitter * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"ParticleEmitterTag", SQTrue);
+    SQFloat color[4];
+    if(SQ_FAILED(get_particle_color(v, color)))
+        return sq_throwerror(v, _SC("Color components must be floats"));
+    
+    instance->set_end_color(color[0], color[1], color[2], color[3]);
+    return 0;
+}
+
+static SQInteger squirrel_particleemitter_emit(HSQUIRRELVM v) {
+    ParticleEmitter * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"ParticleEmitterTag", SQTrue);
+    SQInteger amount;
+    if(SQ_FAILED(sq_getinteger(v, 2, &amount)))
+        return sq_throwerror(v, _SC("Argument 1 not an integer"));
+    
+    if(amount > 0)
+        instance->emit(amount);
+    
+    return 0;
+}
+
+static SQInteger squirrel_particleemitter_update(HSQUIRRELVM v) {
+    ParticleEmitter * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"ParticleEmitterTag", SQTrue);
+    SQFloat dt;
+    if(SQ_FAILED(sq_getfloat(v, 2, &dt)))
+        return sq_throwerror(v, _SC("Argument 1 not a float"));
+    
+    instance->update(dt);
+    return 0;
+}
+
+static SQInteger squirrel_particleemitter_draw(HSQUIRRELVM v) {
+    ParticleEmitter * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"ParticleEmitterTag", SQTrue);
+    instance->draw(Engine::get_singleton()->get_renderer());
+    return 0;
+}
+
+static SQInteger squirrel_particleemitter_clear(HSQUIRRELVM v) {
+    ParticleEmitter * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"ParticleEmitterTag", SQTrue);
+    instance->clear();
+    return 0;
+}
+
+static SQInteger squirrel_particleemitter_getcount(HSQUIRRELVM v) {
+    ParticleEmitter * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"ParticleEmitterTag", SQTrue);
+    sq_pushinteger(v, instance->get_count());
+    return 1;
+}
+
+SQInteger squirrel_layer_destructor(SQUserPointer p, SQInteger SQ_UNUSED_ARG(size)) {
+    RenderTarget * instance = reinterpret_cast<RenderTarget *>(p);
+    delete instance;
+    return 0;
+}
+
+static SQInteger squirrel_layer_constructor(HSQUIRRELVM v) {
+    SQInteger width, height;
+    if(SQ_FAILED(sq_getinteger(v, 2, &width)))
+        return sq_throwerror(v, _SC("Argument 1 not an integer"));
+    
+    if(SQ_FAILED(sq_getinteger(v, 3, &height)))
+        return sq_throwerror(v, _SC("Argument 2 not an integer"));
+    
+    if(width <= 0 || height <= 0)
+        return sq_throwerror(v, _SC("Layer dimensions must be positive"));
+    
+    Renderer * renderer = Engine::get_singleton()->get_renderer();
+    if(renderer == nullptr)
+        return sq_throwerror(v, _SC("Renderer not initialized"));
+    
+    RenderTarget * instance = new RenderTarget(renderer, width, height);
+    sq_setinstanceup(v, 1, instance);
+    sq_setreleasehook(v, 1, squirrel_layer_destructor);
+    return 0;
+}
+
+static SQInteger squirrel_layer_begin(HSQUIRRELVM v) {
+    RenderTarget * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"LayerTag", SQTrue);
+    if(instance->is_active())
+        return sq_throwerror(v, _SC("Layer already begun"));
+    
+    sq_pushbool(v, instance->begin());
+    return 1;
+}
+
+static SQInteger squirrel_layer_end(HSQUIRRELVM v) {
+    RenderTarget * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"LayerTag", SQTrue);
+    if(!instance->end())
+        return sq_throwerror(v, _SC("Layer is not the current target"));
+    
+    return 0;
+}
+
+static SQInteger squirrel_layer_invalidate(HSQUIRRELVM v) {
+    RenderTarget * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"LayerTag", SQTrue);
+    instance->invalidate();
+    return 0;
+}
+
+static SQInteger squirrel_layer_isvalid(HSQUIRRELVM v) {
+    RenderTarget * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"LayerTag", SQTrue);
+    sq_pushbool(v, instance->is_valid());
+    return 1;
+}
+
+static SQInteger squirrel_layer_draw(HSQUIRRELVM v) {
+    RenderTarget * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"LayerTag", SQTrue);
+    Vector2 * position;
+    sq_getinstanceup(v, 2, (SQUserPointer *)&position, (SQUserPointer)"Vector2Tag", SQTrue);
+    instance->draw(Rect2(position->x, position->y, instance->get_width(), instance->get_height()));
+    return 0;
+}
+
+static SQInteger squirrel_layer_drawrect(HSQUIRRELVM v) {
+    RenderTarget * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"LayerTag", SQTrue);
+    Rect2 * rectangle;
+    sq_getinstanceup(v, 2, (SQUserPointer *)&rectangle, (SQUserPointer)"Rect2Tag", SQTrue);
+    instance->draw(*rectangle);
+    return 0;
+}
+
+static SQInteger squirrel_layer_getsize(HSQUIRRELVM v) {
+    RenderTarget * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"LayerTag", SQTrue);
+    push_vector2(v, instance->get_width(), instance->get_height());
+    return 1;
+}
+
+static SQInteger squirrel_graphics_setcamera(HSQUIRRELVM v) {
+    Renderer * renderer = Engine::get_singleton()->get_renderer();
+    if(sq_gettype(v, 2) == OT_NULL) {
+        renderer->reset_camera();
+        return 0;
+    }
+
+    Camera2D * camera;
+    if(SQ_FAILED(sq_getinstanceup(v, 2, (SQUserPointer *)&camera, (SQUserPointer)"Camera2DTag", SQTrue)))
+        return SQ_ERROR;
+    
+    renderer->set_camera(*camera);
+    return 0;
+}
+
+SQInteger squirrel_camera2d_destructor(SQUserPointer p, SQInteger SQ_UNUSED_ARG(size)) {
+    Camera2D * instance = reinterpret_cast<Camera2D *>(p);
+    delete instance;
+    return 0;
+}
+
+static SQInteger squirrel_camera2d_constructor(HSQUIRRELVM v) {
+    Camera2D * instance = new Camera2D();
+    SQInteger top = sq_gettop(v);
+    if(top > 1) {
+        Vector2 * position;
+        if(SQ_FAILED(sq_getinstanceup(v, 2, (SQUserPointer *)&position, (SQUserPointer)"Vector2Tag", SQTrue))) {
+            delete instance;
+            return SQ_ERROR;
+        }
+
+        instance->set_position(*position);
+    }
+
+    SQFloat zoom = 1, rotation = 0;
+    if(top > 2 && SQ_FAILED(sq_getfloat(v, 3, &zoom))) {
+        delete instance;
+        return sq_throwerror(v, _SC("Argument 2 not a float"));
+    }
+
+    if(zoom <= 0) {
+        delete instance;
+        return sq_throwerror(v, _SC("Zoom must be positive"));
+    }
+
+    if(top > 3 && SQ_FAILED(sq_getfloat(v, 4, &rotation))) {
+        delete instance;
+        return sq_throwerror(v, _SC("Argument 3 not a float"));
+    }
+
+    instance->set_zoom(zoom);
+    instance->set_rotation(rotation);
+    sq_setinstanceup(v, 1, instance);
+    sq_setreleasehook(v, 1, squirrel_camera2d_destructor);
+    return 0;
+}
+
+static SQInteger squirrel_camera2d_setposition(HSQUIRRELVM v) {
+    Camera2D * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"Camera2DTag", SQTrue);
+    Vector2 * position;
+    sq_getinstanceup(v, 2, (SQUserPointer *)&position, (SQUserPointer)"Vector2Tag", SQTrue);
+    instance->set_position(*position);
+    return 0;
+}
+
+static SQInteger squirrel_camera2d_getposition(HSQUIRRELVM v) {
+    Camera2D * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"Camera2DTag", SQTrue);
+    push_vector2(v, instance->get_position());
+    return 1;
+}
+
+static SQInteger squirrel_camera2d_setzoom(HSQUIRRELVM v) {
+    Camera2D * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"Camera2DTag", SQTrue);
+    SQFloat zoom;
+    if(SQ_FAILED(sq_getfloat(v, 2, &zoom)))
+        return sq_throwerror(v, _SC("Argument 1 not a float"));
+    
+    if(zoom <= 0)
+        return sq_throwerror(v, _SC("Zoom must be positive"));
+    
+    instance->set_zoom(zoom);
+    return 0;
+}
+
+static SQInteger squirrel_camera2d_getzoom(HSQUIRRELVM v) {
+    Camera2D * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"Camera2DTag", SQTrue);
+    sq_pushfloat(v, instance->get_zoom());
+    return 1;
+}
+
+static SQInteger squirrel_camera2d_setrotation(HSQUIRRELVM v) {
+    Camera2D * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"Camera2DTag", SQTrue);
+    SQFloat rotation;
+    if(SQ_FAILED(sq_getfloat(v, 2, &rotation)))
+        return sq_throwerror(v, _SC("Argument 1 not a float"));
+    
+    instance->set_rotation(rotation);
+    return 0;
+}
+
+static SQInteger squirrel_camera2d_getrotation(HSQUIRRELVM v) {
+    Camera2D * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"Camera2DTag", SQTrue);
+    sq_pushfloat(v, instance->get_rotation());
+    return 1;
+}
+
+static SQInteger squirrel_camera2d_screentoworld(HSQUIRRELVM v) {
+    Camera2D * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"Camera2DTag", SQTrue);
+    Vector2 * point;
+    sq_getinstanceup(v, 2, (SQUserPointer *)&point, (SQUserPointer)"Vector2Tag", SQTrue);
+    Renderer * renderer = Engine::get_singleton()->get_renderer();
+    Vector2 world = instance->screen_to_world(*point, renderer->get_width(), renderer->get_height());
+    push_vector2(v, world);
+    return 1;
+}
+
+static SQInteger squirrel_profiler_issupported(HSQUIRRELVM v) {
+    sq_pushbool(v, Engine::get_singleton()->get_renderer()->get_profiler()->is_supported());
+    return 1;
+}
+
+static SQInteger squirrel_profiler_getgputime(HSQUIRRELVM v) {
+    sq_pushfloat(v, Engine::get_singleton()->get_renderer()->get_profiler()->get_gpu_time());
+    return 1;
+}
+
+static SQInteger squirrel_profiler_getcputime(HSQUIRRELVM v) {
+    sq_pushfloat(v, Engine::get_singleton()->get_renderer()->get_profiler()->get_cpu_time());
+    return 1;
+}
+
+static SQInteger squirrel_profiler_getpasstime(HSQUIRRELVM v) {
+    const SQChar * name;
+    if(SQ_FAILED(sq_getstring(v, 2, &name)))
+        return sq_throwerror(v, _SC("Argument 1 not a string"));
+    
+    const std::unordered_map<std::string, double> & times = Engine::get_singleton()->get_renderer()->get_profiler()->get_pass_times();
+    auto found = times.find(name);
+    if(found == times.end())
+        sq_pushnull(v);
+    else
+        sq_pushfloat(v, found->second);
+    
+    return 1;
+}
+
+static SQInteger squirrel_profiler_getpasses(HSQUIRRELVM v) {
+    sq_newtable(v);
+    for(const auto & pass : Engine::get_singleton()->get_renderer()->get_profiler()->get_pass_times()) {
+        sq_pushstring(v, pass.first.c_str(), -1);
+        sq_pushfloat(v, pass.second);
+        sq_newslot(v, -3, SQFalse);
+    }
+
+    return 1;
+}
+
+static SQInteger squirrel_profiler_getrenderstats(HSQUIRRELVM v) {
+    const RenderStats & stats = Engine::get_singleton()->get_renderer()->get_device()->get_stats();
+    sq_newtable(v);
+    sq_pushstring(v, _SC("draw_calls"), -1);
+    sq_pushinteger(v, stats.draw_calls);
+    sq_newslot(v, -3, SQFalse);
+    sq_pushstring(v, _SC("vertices"), -1);
+    sq_pushinteger(v, stats.vertices);
+    sq_newslot(v, -3, SQFalse);
+    sq_pushstring(v, _SC("texture_binds"), -1);
+    sq_pushinteger(v, stats.texture_binds);
+    sq_newslot(v, -3, SQFalse);
+    sq_pushstring(v, _SC("state_changes"), -1);
+    sq_pushinteger(v, stats.state_changes);
+    sq_newslot(v, -3, SQFalse);
+    sq_pushstring(v, _SC("uploaded_bytes"), -1);
+    sq_pushinteger(v, stats.uploaded_bytes);
+    sq_newslot(v, -3, SQFalse);
+    return 1;
+}
+
+static SQInteger squirrel_profiler_getbackend(HSQUIRRELVM v) {
+    sq_pushstring(v, Engine::get_singleton()->get_renderer()->get_device()->get_name(), -1);
+    return 1;
+}
+
+static SQInteger squirrel_profiler_beginpass(HSQUIRRELVM v) {
+    const SQChar * name;
+    if(SQ_FAILED(sq_getstring(v, 2, &name)))
+        return sq_throwerror(v, _SC("Argument 1 not a string"));
+    
+    Engine::get_singleton()->get_renderer()->begin_pass(name);
+    return 0;
+}
+
+static SQInteger squirrel_profiler_endpass(HSQUIRRELVM v) {
+    Engine::get_singleton()->get_renderer()->end_pass();
+    return 0;
+}
+
+void register_graphics_wrapper(HSQUIRRELVM v) {
+    sq_pushstring(v, _SC("fill_rectangle"), -1);
+    sq_newclosure(v, squirrel_graphics_fillrectangle, 0);
+    sq_setparamscheck(v, 2, _SC(".x"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("draw_rectangle"), -1);
+    sq_newclosure(v, squirrel_graphics_drawrectangle, 0);
+    sq_setparamscheck(v, 2, _SC(".x"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("fill_circle"), -1);
+    sq_newclosure(v, squirrel_graphics_fillcircle, 0);
+    sq_setparamscheck(v, 3, _SC(".xn"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("draw_circle"), -1);
+    sq_newclosure(v, squirrel_graphics_drawcircle, 0);
+    sq_setparamscheck(v, 3, _SC(".xn"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("draw_line"), -1);
+    sq_newclosure(v, squirrel_graphics_drawline, 0);
+    sq_setparamscheck(v, 3, _SC(".xx"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("fill_rectangles"), -1);
+    sq_newclosure(v, squirrel_graphics_fillrectangles, 0);
+    sq_setparamscheck(v, 2, _SC(".a|x"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("draw_many"), -1);
+    sq_newclosure(v, squirrel_graphics_drawmany, 0);
+    sq_setparamscheck(v, 3, _SC(".xx"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("draw_text"), -1);
+    sq_newclosure(v, squirrel_graphics_drawtext, 0);
+    sq_setparamscheck(v, -3, _SC(".sxx"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("measure_text"), -1);
+    sq_newclosure(v, squirrel_graphics_measuretext, 0);
+    sq_setparamscheck(v, -2, _SC(".sx"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("layout_text"), -1);
+    sq_newclosure(v, squirrel_graphics_layouttext, 0);
+    sq_setparamscheck(v, -3, _SC(".snnx"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("set_layer"), -1);
+    sq_newclosure(v, squirrel_graphics_setlayer, 0);
+    sq_setparamscheck(v, 2, _SC(".n"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("set_layer_sorted"), -1);
+    sq_newclosure(v, squirrel_graphics_setlayersorted, 0);
+    sq_setparamscheck(v, 3, _SC(".nb"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("set_blend_mode"), -1);
+    sq_newclosure(v, squirrel_graphics_setblendmode, 0);
+    sq_setparamscheck(v, 2, _SC(".n"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("set_depth"), -1);
+    sq_newclosure(v, squirrel_graphics_setdepth, 0);
+    sq_setparamscheck(v, 2, _SC(".n"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("set_camera"), -1);
+    sq_newclosure(v, squirrel_graphics_setcamera, 0);
+    sq_setparamscheck(v, 2, _SC(".x|o"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("TextAlign"), -1);
+    sq_newtable(v);
+    sq_pushstring(v, _SC("LEFT"), -1);
+    sq_pushinteger(v, ALIGN_LEFT);
+    sq_newslot(v, -3, SQFalse);
+    sq_pushstring(v, _SC("CENTER"), -1);
+    sq_pushinteger(v, ALIGN_CENTER);
+    sq_newslot(v, -3, SQFalse);
+    sq_pushstring(v, _SC("RIGHT"), -1);
+    sq_pushinteger(v, ALIGN_RIGHT);
+    sq_newslot(v, -3, SQFalse);
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("BlendMode"), -1);
+    sq_newtable(v);
+    sq_pushstring(v, _SC("ALPHA"), -1);
+    sq_pushinteger(v, BLEND_ALPHA);
+    sq_newslot(v, -3, SQFalse);
+    sq_pushstring(v, _SC("ADD"), -1);
+    sq_pushinteger(v, BLEND_ADD);
+    sq_newslot(v, -3, SQFalse);
+    sq_pushstring(v, _SC("MULTIPLY"), -1);
+    sq_pushinteger(v, BLEND_MULTIPLY);
+    sq_newslot(v, -3, SQFalse);
+    sq_pushstring(v, _SC("PREMULTIPLIED"), -1);
+    sq_pushinteger(v, BLEND_PREMULTIPLIED);
+    sq_newslot(v, -3, SQFalse);
+    sq_pushstring(v, _SC("NONE"), -1);
+    sq_pushinteger(v, BLEND_NONE);
+    sq_newslot(v, -3, SQFalse);
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("Font"), -1);
+    sq_newclass(v, SQFalse);
+    sq_settypetag(v, -1, (SQUserPointer)"FontTag");
+
+    sq_pushstring(v, _SC("constructor"), -1);
+    sq_newclosure(v, squirrel_font_constructor, 0);
+    sq_setparamscheck(v, -3, _SC(".snb"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("Text"), -1);
+    sq_newclass(v, SQFalse);
+    sq_settypetag(v, -1, (SQUserPointer)"TextTag");
+
+    sq_pushstring(v, _SC("_font"), -1);
+    sq_pushnull(v);
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("constructor"), -1);
+    sq_newclosure(v, squirrel_text_constructor, 0);
+    sq_setparamscheck(v, -2, _SC(".sx"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("set_string"), -1);
+    sq_newclosure(v, squirrel_text_setstring, 0);
+    sq_setparamscheck(v, 2, _SC("xs"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("get_string"), -1);
+    sq_newclosure(v, squirrel_text_getstring, 0);
+    sq_setparamscheck(v, 1, _SC("x"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("set_font"), -1);
+    sq_newclosure(v, squirrel_text_setfont, 0);
+    sq_setparamscheck(v, 2, _SC("xx"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("set_color"), -1);
+    sq_newclosure(v, squirrel_text_setcolor, 0);
+    sq_setparamscheck(v, -4, _SC("xnnnn"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("get_size"), -1);
+    sq_newclosure(v, squirrel_text_getsize, 0);
+    sq_setparamscheck(v, 1, _SC("x"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("draw"), -1);
+    sq_newclosure(v, squirrel_text_draw, 0);
+    sq_setparamscheck(v, 2, _SC("xx"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("Texture"), -1);
+    sq_newclass(v, SQFalse);
+    sq_settypetag(v, -1, (SQUserPointer)"TextureTag");
+
+    sq_pushstring(v, _SC("constructor"), -1);
+    sq_newclosure(v, squirrel_texture_constructor, 0);
+    sq_setparamscheck(v, 2, _SC(".s"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("draw"), -1);
+    sq_newclosure(v, squirrel_texture_draw, 0);
+    sq_setparamscheck(v, 2, _SC("xx"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("load_async"), -1);
+    sq_newclosure(v, squirrel_texture_loadasync, 0);
+    sq_setparamscheck(v, -2, _SC("ysc"));
+    sq_newslot(v, -3, SQTrue);
+
+    sq_pushstring(v, _SC("is_ready"), -1);
+    sq_newclosure(v, squirrel_texture_isready, 0);
+    sq_setparamscheck(v, 1, _SC("x"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("draw_rect"), -1);
+    sq_newclosure(v, squirrel_texture_drawrect, 0);
+    sq_setparamscheck(v, -2, _SC("xxx"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("get_size"), -1);
+    sq_newclosure(v, squirrel_texture_getsize, 0);
+    sq_setparamscheck(v, 1, _SC("x"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("TileMap"), -1);
+    sq_newclass(v, SQFalse);
+    sq_settypetag(v, -1, (SQUserPointer)"TileMapTag");
+
+    sq_pushstring(v, _SC("_tileset"), -1);
+    sq_pushnull(v);
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("constructor"), -1);
+    sq_newclosure(v, squirrel_tilemap_constructor, 0);
+    sq_setparamscheck(v, 6, _SC(".xnnnn"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("set_tile"), -1);
+    sq_newclosure(v, squirrel_tilemap_settile, 0);
+    sq_setparamscheck(v, 4, _SC("xnnn"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("get_tile"), -1);
+    sq_newclosure(v, squirrel_tilemap_gettile, 0);
+    sq_setparamscheck(v, 3, _SC("xnn"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("set_tileset"), -1);
+    sq_newclosure(v, squirrel_tilemap_settileset, 0);
+    sq_setparamscheck(v, 2, _SC("xx"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("set_position"), -1);
+    sq_newclosure(v, squirrel_tilemap_setposition, 0);
+    sq_setparamscheck(v, 2, _SC("xx"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("draw"), -1);
+    sq_newclosure(v, squirrel_tilemap_draw, 0);
+    sq_setparamscheck(v, 1, _SC("x"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("ParticleEmitter"), -1);
+    sq_newclass(v, SQFalse);
+    sq_settypetag(v, -1, (SQUserPointer)"ParticleEmitterTag");
+
+    sq_pushstring(v, _SC("_texture"), -1);
+    sq_pushnull(v);
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("constructor"), -1);
+    sq_newclosure(v, squirrel_particleemitter_constructor, 0);
+    sq_setparamscheck(v, -1, _SC(".n"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("set_texture"), -1);
+    sq_newclosure(v, squirrel_particleemitter_settexture, 0);
+    sq_setparamscheck(v, 2, _SC("xx|o"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("set_position"), -1);
+    sq_newclosure(v, squirrel_particleemitter_setposition, 0);
+    sq_setparamscheck(v, 2, _SC("xx"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("set_gravity"), -1);
+    sq_newclosure(v, squirrel_particleemitter_setgravity, 0);
+    sq_setparamscheck(v, 2, _SC("xx"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("set_rate"), -1);
+    sq_newclosure(v, squirrel_particleemitter_setrate, 0);
+    sq_setparamscheck(v, 2, _SC("xn"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("set_lifetime"), -1);
+    sq_newclosure(v, squirrel_particleemitter_setlifetime, 0);
+    sq_setparamscheck(v, 3, _SC("xnn"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("set_speed"), -1);
+    sq_newclosure(v, squirrel_particleemitter_setspeed, 0);
+    sq_setparamscheck(v, 3, _SC("xnn"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("set_direction"), -1);
+    sq_newclosure(v, squirrel_particleemitter_setdirection, 0);
+    sq_setparamscheck(v, 3, _SC("xnn"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("set_sizes"), -1);
+    sq_newclosure(v, squirrel_particleemitter_setsizes, 0);
+    sq_setparamscheck(v, 3, _SC("xnn"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("set_start_color"), -1);
+    sq_newclosure(v, squirrel_particleemitter_setstartcolor, 0);
+    sq_setparamscheck(v, -4, _SC("xnnnn"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("set_end_color"), -1);
+    sq_newclosure(v, squirrel_particleemitter_setendcolor, 0);
+    sq_setparamscheck(v, -4, _SC("xnnnn"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("emit"), -1);
+    sq_newclosure(v, squirrel_particleemitter_emit, 0);
+    sq_setparamscheck(v, 2, _SC("xn"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("update"), -1);
+    sq_newclosure(v, squirrel_particleemitter_update, 0);
+    sq_setparamscheck(v, 2, _SC("xn"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("draw"), -1);
+    sq_newclosure(v, squirrel_particleemitter_draw, 0);
+    sq_setparamscheck(v, 1, _SC("x"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("clear"), -1);
+    sq_newclosure(v, squirrel_particleemitter_clear, 0);
+    sq_setparamscheck(v, 1, _SC("x"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("get_count"), -1);
+    sq_newclosure(v, squirrel_particleemitter_getcount, 0);
+    sq_setparamscheck(v, 1, _SC("x"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("Layer"), -1);
+    sq_newclass(v, SQFalse);
+    sq_settypetag(v, -1, (SQUserPointer)"LayerTag");
+
+    sq_pushstring(v, _SC("constructor"), -1);
+    sq_newclosure(v, squirrel_layer_constructor, 0);
+    sq_setparamscheck(v, 3, _SC(".nn"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("begin"), -1);
+    sq_newclosure(v, squirrel_layer_begin, 0);
+    sq_setparamscheck(v, 1, _SC("x"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("end"), -1);
+    sq_newclosure(v, squirrel_layer_end, 0);
+    sq_setparamscheck(v, 1, _SC("x"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("invalidate"), -1);
+    sq_newclosure(v, squirrel_layer_invalidate, 0);
+    sq_setparamscheck(v, 1, _SC("x"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("is_valid"), -1);
+    sq_newclosure(v, squirrel_layer_isvalid, 0);
+    sq_setparamscheck(v, 1, _SC("x"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("draw"), -1);
+    sq_newclosure(v, squirrel_layer_draw, 0);
+    sq_setparamscheck(v, 2, _SC("xx"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("draw_rect"), -1);
+    sq_newclosure(v, squirrel_layer_drawrect, 0);
+    sq_setparamscheck(v, 2, _SC("xx"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("get_size"), -1);
+    sq_newclosure(v, squirrel_layer_getsize, 0);
+    sq_setparamscheck(v, 1, _SC("x"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("Camera2D"), -1);
+    sq_newclass(v, SQFalse);
+    sq_settypetag(v, -1, (SQUserPointer)"Camera2DTag");
+
+    sq_pushstring(v, _SC("constructor"), -1);
+    sq_newclosure(v, squirrel_camera2d_constructor, 0);
+    sq_setparamscheck(v, -1, _SC(".xnn"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("set_position"), -1);
+    sq_newclosure(v, squirrel_camera2d_setposition, 0);
+    sq_setparamscheck(v, 2, _SC("xx"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("get_position"), -1);
+    sq_newclosure(v, squirrel_camera2d_getposition, 0);
+    sq_setparamscheck(v, 1, _SC("x"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("set_zoom"), -1);
+    sq_newclosure(v, squirrel_camera2d_setzoom, 0);
+    sq_setparamscheck(v, 2, _SC("xn"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("get_zoom"), -1);
+    sq_newclosure(v, squirrel_camera2d_getzoom, 0);
+    sq_setparamscheck(v, 1, _SC("x"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("set_rotation"), -1);
+    sq_newclosure(v, squirrel_camera2d_setrotation, 0);
+    sq_setparamscheck(v, 2, _SC("xn"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("get_rotation"), -1);
+    sq_newclosure(v, squirrel_camera2d_getrotation, 0);
+    sq_setparamscheck(v, 1, _SC("x"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("screen_to_world"), -1);
+    sq_newclosure(v, squirrel_camera2d_screentoworld, 0);
+    sq_setparamscheck(v, 2, _SC("xx"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("Profiler"), -1);
+    sq_newtable(v);
+
+    sq_pushstring(v, _SC("is_supported"), -1);
+    sq_newclosure(v, squirrel_profiler_issupported, 0);
+    sq_setparamscheck(v, 1, _SC("."));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("get_gpu_time"), -1);
+    sq_newclosure(v, squirrel_profiler_getgputime, 0);
+    sq_setparamscheck(v, 1, _SC("."));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("get_cpu_time"), -1);
+    sq_newclosure(v, squirrel_profiler_getcputime, 0);
+    sq_setparamscheck(v, 1, _SC("."));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("get_pass_time"), -1);
+    sq_newclosure(v, squirrel_profiler_getpasstime, 0);
+    sq_setparamscheck(v, 2, _SC(".s"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("get_passes"), -1);
+    sq_newclosure(v, squirrel_profiler_getpasses, 0);
+    sq_setparamscheck(v, 1, _SC("."));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("get_render_stats"), -1);
+    sq_newclosure(v, squirrel_profiler_getrenderstats, 0);
+    sq_setparamscheck(v, 1, _SC("."));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("get_backend"), -1);
+    sq_newclosure(v, squirrel_profiler_getbackend, 0);
+    sq_setparamscheck(v, 1, _SC("."));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("begin_pass"), -1);
+    sq_newclosure(v, squirrel_profiler_beginpass, 0);
+    sq_setparamscheck(v, 2, _SC(".s"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("end_pass"), -1);
+    sq_newclosure(v, squirrel_profiler_endpass, 0);
+    sq_setparamscheck(v, 1, _SC("."));
+    sq_newslot(v, -3, SQFalse);
 
-    sq_pushstring(v, _SC("draw_text"), -1);
-    sq_newclosure(v, squirrel_graphics_drawtext, 0);
-    sq_setparamscheck(v, -3, _SC(".sxx"));
     sq_newslot(v, -3, SQFalse);
 }
\ No newline at end of file
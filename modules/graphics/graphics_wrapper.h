@@ -26,6 +26,14 @@
 
 #include <squirrel.h>
 
+extern SQInteger squirrel_camera2d_destructor(SQUserPointer p, SQInteger size);
+extern SQInteger squirrel_font_destructor(SQUserPointer p, SQInteger size);
+extern SQInteger squirrel_layer_destructor(SQUserPointer p, SQInteger size);
+extern SQInteger squirrel_particleemitter_destructor(SQUserPointer p, SQInteger size);
+extern SQInteger squirrel_text_destructor(SQUserPointer p, SQInteger size);
+extern SQInteger squirrel_texture_destructor(SQUserPointer p, SQInteger size);
+extern SQInteger squirrel_tilemap_destructor(SQUserPointer p, SQInteger size);
+
 void register_graphics_wrapper(HSQUIRRELVM v);
 
 #endif
\ No newline at end of file
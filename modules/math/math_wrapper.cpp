@@ -24,23 +24,47 @@
 #include "math_wrapper.h"
 #include "math/vector2.h"
 #include "math/rect2.h"
+#include "math/vector2_array.h"
 #include "thirdparty/squirrel/scriptvm.h"
+#include <new>
+#include <sqstdblob.h>
 #include <stdio.h>
+#include <string.h>
+#include <vector>
 
-SQInteger squirrel_vector2_destructor(SQUserPointer p, SQInteger SQ_UNUSED_ARG(size)) {
-    Vector2 * instance = reinterpret_cast<Vector2 *>(p);
-    delete instance;
-    return 0;
+static HSQOBJECT vector2_class;
+static HSQOBJECT rect2_class;
+
+static SQUserPointer push_instance(HSQUIRRELVM v, HSQOBJECT type) {
+    sq_pushobject(v, type);
+    sq_createinstance(v, -1);
+    sq_remove(v, -2);
+    SQUserPointer storage;
+    sq_getinstanceup(v, -1, &storage, 0, SQFalse);
+    return storage;
+}
+
+Vector2 * push_vector2(HSQUIRRELVM v, double x, double y) {
+    return new(push_instance(v, vector2_class)) Vector2(x, y);
+}
+
+Vector2 * push_vector2(HSQUIRRELVM v, const Vector2 & value) {
+    return new(push_instance(v, vector2_class)) Vector2(value);
+}
+
+Rect2 * push_rect2(HSQUIRRELVM v, const Rect2 & value) {
+    return new(push_instance(v, rect2_class)) Rect2(value);
 }
 
 static SQInteger squirrel_vector2_constructor(HSQUIRRELVM v) {
     Vector2 * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, 0, SQFalse);
     if(sq_gettop(v) == 1)
-        instance = new Vector2();
+        new(instance) Vector2();
     else if(sq_gettop(v) == 2) {
         Vector2 * other;
         sq_getinstanceup(v, 2, (SQUserPointer *)&other, (SQUserPointer)"Vector2Tag", SQTrue);
-        instance = new Vector2(*other);
+        new(instance) Vector2(*other);
     } else if(sq_gettop(v) == 3) {
         SQFloat x;
         SQFloat y;
@@ -50,15 +74,13 @@ static SQInteger squirrel_vector2_constructor(HSQUIRRELVM v) {
         if(SQ_FAILED(sq_getfloat(v, 3, &y)))
             return sq_throwerror(v, _SC("Argument 2 not a float"));
         
-        instance = new Vector2(x, y);
+        new(instance) Vector2(x, y);
     } else {
         char buffer[1024];
         sprintf(buffer, "Too many arguments (expected 2, got %d)", sq_gettop(v) - 1);
         return sq_throwerror(v, _SC(buffer));
     }
 
-    sq_setinstanceup(v, 1, instance);
-    sq_setreleasehook(v, 1, squirrel_vector2_destructor);
     return 0;
 }
 
@@ -101,18 +123,7 @@ static SQInteger squirrel_vector2_sety(HSQUIRRELVM v) {
 static SQInteger squirrel_vector2_normalized(HSQUIRRELVM v) {
     Vector2 * instance;
     sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"Vector2Tag", SQTrue);
-    sq_pushroottable(v);
-    sq_pushstring(v, _SC("Mousey"), -1);
-    sq_get(v, -2);
-    sq_pushstring(v, _SC("Vector2"), -1);
-    sq_get(v, -2);
-    sq_createinstance(v, -1);
-    Vector2 * result = new Vector2(instance->normalized());
-    sq_setinstanceup(v, -1, result);
-    sq_setreleasehook(v, -1, squirrel_vector2_destructor);
-    sq_remove(v, -2);
-    sq_remove(v, -2);
-    sq_remove(v, -2);
+    push_vector2(v, instance->normalized());
     return 1;
 }
 
@@ -139,18 +150,71 @@ static SQInteger squirrel_vector2_project(HSQUIRRELVM v) {
     sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"Vector2Tag", SQTrue);
     Vector2 * to;
     sq_getinstanceup(v, 2, (SQUserPointer *)&to, (SQUserPointer)"Vector2Tag", SQTrue);
-    sq_pushroottable(v);
-    sq_pushstring(v, _SC("Mousey"), -1);
-    sq_get(v, -2);
-    sq_pushstring(v, _SC("Vector2"), -1);
-    sq_get(v, -2);
-    sq_createinstance(v, -1);
-    Vector2 * result = new Vector2(instance->project(*to));
-    sq_setinstanceup(v, -1, result);
-    sq_setreleasehook(v, -1, squirrel_vector2_destructor);
-    sq_remove(v, -2);
-    sq_remove(v, -2);
-    sq_remove(v, -2);
+    push_vector2(v, instance->project(*to));
+    return 1;
+}
+
+static SQInteger squirrel_vector2_set(HSQUIRRELVM v) {
+    Vector2 * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"Vector2Tag", SQTrue);
+    SQFloat x;
+    SQFloat y;
+    if(SQ_FAILED(sq_getfloat(v, 2, &x)))
+        return sq_throwerror(v, _SC("Argument 1 not a float"));
+    
+    if(SQ_FAILED(sq_getfloat(v, 3, &y)))
+        return sq_throwerror(v, _SC("Argument 2 not a float"));
+    
+    instance->set(x, y);
+    sq_push(v, 1);
+    return 1;
+}
+
+static SQInteger squirrel_vector2_addinplace(HSQUIRRELVM v) {
+    Vector2 * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"Vector2Tag", SQTrue);
+    Vector2 * other;
+    if(SQ_FAILED(sq_getinstanceup(v, 2, (SQUserPointer *)&other, (SQUserPointer)"Vector2Tag", SQTrue)))
+        return SQ_ERROR;
+    
+    instance->add_in_place(*other);
+    sq_push(v, 1);
+    return 1;
+}
+
+static SQInteger squirrel_vector2_scaleinplace(HSQUIRRELVM v) {
+    Vector2 * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"Vector2Tag", SQTrue);
+    SQFloat s;
+    if(SQ_FAILED(sq_getfloat(v, 2, &s)))
+        return sq_throwerror(v, _SC("Argument 1 not a float"));
+    
+    instance->scale_in_place(s);
+    sq_push(v, 1);
+    return 1;
+}
+
+static SQInteger squirrel_vector2_mad(HSQUIRRELVM v) {
+    Vector2 * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"Vector2Tag", SQTrue);
+    Vector2 * other;
+    if(SQ_FAILED(sq_getinstanceup(v, 2, (SQUserPointer *)&other, (SQUserPointer)"Vector2Tag", SQTrue)))
+        return SQ_ERROR;
+    
+    SQFloat s;
+    if(SQ_FAILED(sq_getfloat(v, 3, &s)))
+        return sq_throwerror(v, _SC("Argument 2 not a float"));
+    
+    instance->mad(*other, s);
+    sq_push(v, 1);
+    return 1;
+}
+
+static SQInteger squirrel_vector2_normalizeinplace(HSQUIRRELVM v) {
+    Vector2 * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"Vector2Tag", SQTrue);
+    instance->normalize_in_place();
+    sq_push(v, 1);
     return 1;
 }
 
@@ -159,18 +223,7 @@ static SQInteger squirrel_vector2_add(HSQUIRRELVM v) {
     sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"Vector2Tag", SQTrue);
     Vector2 * with;
     sq_getinstanceup(v, 2, (SQUserPointer *)&with, (SQUserPointer)"Vector2Tag", SQTrue);
-    sq_pushroottable(v);
-    sq_pushstring(v, _SC("Mousey"), -1);
-    sq_get(v, -2);
-    sq_pushstring(v, _SC("Vector2"), -1);
-    sq_get(v, -2);
-    sq_createinstance(v, -1);
-    Vector2 * result = new Vector2(instance->x + with->x, instance->y + with->y);
-    sq_setinstanceup(v, -1, result);
-    sq_setreleasehook(v, -1, squirrel_vector2_destructor);
-    sq_remove(v, -2);
-    sq_remove(v, -2);
-    sq_remove(v, -2);
+    push_vector2(v, instance->x + with->x, instance->y + with->y);
     return 1;
 }
 
@@ -179,18 +232,7 @@ static SQInteger squirrel_vector2_sub(HSQUIRRELVM v) {
     sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"Vector2Tag", SQTrue);
     Vector2 * with;
     sq_getinstanceup(v, 2, (SQUserPointer *)&with, (SQUserPointer)"Vector2Tag", SQTrue);
-    sq_pushroottable(v);
-    sq_pushstring(v, _SC("Mousey"), -1);
-    sq_get(v, -2);
-    sq_pushstring(v, _SC("Vector2"), -1);
-    sq_get(v, -2);
-    sq_createinstance(v, -1);
-    Vector2 * result = new Vector2(instance->x - with->x, instance->y - with->y);
-    sq_setinstanceup(v, -1, result);
-    sq_setreleasehook(v, -1, squirrel_vector2_destructor);
-    sq_remove(v, -2);
-    sq_remove(v, -2);
-    sq_remove(v, -2);
+    push_vector2(v, instance->x - with->x, instance->y - with->y);
     return 1;
 }
 
@@ -201,18 +243,7 @@ static SQInteger squirrel_vector2_mul(HSQUIRRELVM v) {
     if(SQ_FAILED(sq_getfloat(v, 2, &with)))
         return sq_throwerror(v, _SC("Argument 1 not a float"));
     
-    sq_pushroottable(v);
-    sq_pushstring(v, _SC("Mousey"), -1);
-    sq_get(v, -2);
-    sq_pushstring(v, _SC("Vector2"), -1);
-    sq_get(v, -2);
-    sq_createinstance(v, -1);
-    Vector2 * result = new Vector2(instance->x * with, instance->y * with);
-    sq_setinstanceup(v, -1, result);
-    sq_setreleasehook(v, -1, squirrel_vector2_destructor);
-    sq_remove(v, -2);
-    sq_remove(v, -2);
-    sq_remove(v, -2);
+    push_vector2(v, instance->x * with, instance->y * with);
     return 1;
 }
 
@@ -223,59 +254,32 @@ static SQInteger squirrel_vector2_div(HSQUIRRELVM v) {
     if(SQ_FAILED(sq_getfloat(v, 2, &with)))
         return sq_throwerror(v, _SC("Argument 1 not a float"));
     
-    sq_pushroottable(v);
-    sq_pushstring(v, _SC("Mousey"), -1);
-    sq_get(v, -2);
-    sq_pushstring(v, _SC("Vector2"), -1);
-    sq_get(v, -2);
-    sq_createinstance(v, -1);
-    Vector2 * result = new Vector2(instance->x / with, instance->y / with);
-    sq_setinstanceup(v, -1, result);
-    sq_setreleasehook(v, -1, squirrel_vector2_destructor);
-    sq_remove(v, -2);
-    sq_remove(v, -2);
-    sq_remove(v, -2);
+    push_vector2(v, instance->x / with, instance->y / with);
     return 1;
 }
 
 static SQInteger squirrel_vector2_unm(HSQUIRRELVM v) {
     Vector2 * instance;
     sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"Vector2Tag", SQTrue);
-    sq_pushroottable(v);
-    sq_pushstring(v, _SC("Mousey"), -1);
-    sq_get(v, -2);
-    sq_pushstring(v, _SC("Vector2"), -1);
-    sq_get(v, -2);
-    sq_createinstance(v, -1);
-    Vector2 * result = new Vector2(-instance->x, -instance->y);
-    sq_setinstanceup(v, -1, result);
-    sq_setreleasehook(v, -1, squirrel_vector2_destructor);
-    sq_remove(v, -2);
-    sq_remove(v, -2);
-    sq_remove(v, -2);
+    push_vector2(v, -instance->x, -instance->y);
     return 1;
 }
 
-SQInteger squirrel_rect2_destructor(SQUserPointer p, SQInteger SQ_UNUSED_ARG(size)) {
-    Rect2 * instance = reinterpret_cast<Rect2 *>(p);
-    delete instance;
-    return 0;
-}
-
 static SQInteger squirrel_rect2_constructor(HSQUIRRELVM v) {
     Rect2 * instance;
+    sq_getinstanceup(v, 1, (SQUserPointer *)&instance, 0, SQFalse);
     if(sq_gettop(v) == 1)
-        instance = new Rect2();
+        new(instance) Rect2();
     else if(sq_gettop(v) == 2) {
         Rect2 * other;
         sq_getinstanceup(v, 2, (SQUserPointer *)&other, (SQUserPointer)"Rect2Tag", SQTrue);
-        instance = new Rect2(*other);
+        new(instance) Rect2(*other);
     } else if(sq_gettop(v) == 3) {
         Vector2 * position;
         Vector2 * size;
         sq_getinstanceup(v, 2, (SQUserPointer *)&position, (SQUserPointer)"Vector2Tag", SQTrue);
         sq_getinstanceup(v, 3, (SQUserPointer *)&size, (SQUserPointer)"Vector2Tag", SQTrue);
-        instance = new Rect2(*position, *size);
+        new(instance) Rect2(*position, *size);
     } else {
         if(sq_gettop(v) < 5) {
             char buffer[1024];
@@ -302,30 +306,17 @@ static SQInteger squirrel_rect2_constructor(HSQUIRRELVM v) {
             if(SQ_FAILED(sq_getfloat(v, 5, &height)))
                 return sq_throwerror(v, _SC("Argument 4 not a float"));
             
-            instance = new Rect2(x, y, width, height);
+            new(instance) Rect2(x, y, width, height);
         }
     }
 
-    sq_setinstanceup(v, 1, instance);
-    sq_setreleasehook(v, 1, squirrel_rect2_destructor);
     return 0;
 }
 
 static SQInteger squirrel_rect2_getposition(HSQUIRRELVM v) {
     Rect2 * instance;
     sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"Rect2Tag", SQTrue);
-    sq_pushroottable(v);
-    sq_pushstring(v, _SC("Mousey"), -1);
-    sq_get(v, -2);
-    sq_pushstring(v, _SC("Vector2"), -1);
-    sq_get(v, -2);
-    sq_createinstance(v, -1);
-    Vector2 * position = new Vector2(instance->position);
-    sq_setinstanceup(v, -1, position);
-    sq_setreleasehook(v, -1, squirrel_vector2_destructor);
-    sq_remove(v, -2);
-    sq_remove(v, -2);
-    sq_remove(v, -2);
+    push_vector2(v, instance->position);
     return 1;
 }
 
@@ -341,18 +332,7 @@ static SQInteger squirrel_rect2_setposition(HSQUIRRELVM v) {
 static SQInteger squirrel_rect2_getsize(HSQUIRRELVM v) {
     Rect2 * instance;
     sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"Rect2Tag", SQTrue);
-    sq_pushroottable(v);
-    sq_pushstring(v, _SC("Mousey"), -1);
-    sq_get(v, -2);
-    sq_pushstring(v, _SC("Vector2"), -1);
-    sq_get(v, -2);
-    sq_createinstance(v, -1);
-    Vector2 * size = new Vector2(instance->size);
-    sq_setinstanceup(v, -1, size);
-    sq_setreleasehook(v, -1, squirrel_vector2_destructor);
-    sq_remove(v, -2);
-    sq_remove(v, -2);
-    sq_remove(v, -2);
+    push_vector2(v, instance->size);
     return 1;
 }
 
@@ -370,18 +350,7 @@ static SQInteger squirrel_rect2_intersect(HSQUIRRELVM v) {
     sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"Rect2Tag", SQTrue);
     Rect2 * with;
     sq_getinstanceup(v, 2, (SQUserPointer *)&with, (SQUserPointer)"Rect2Tag", SQTrue);
-    sq_pushroottable(v);
-    sq_pushstring(v, _SC("Mousey"), -1);
-    sq_get(v, -2);
-    sq_pushstring(v, _SC("Rect2"), -1);
-    sq_get(v, -2);
-    sq_createinstance(v, -1);
-    Rect2 * result = new Rect2(instance->intersect(*with));
-    sq_setinstanceup(v, -1, result);
-    sq_setreleasehook(v, -1, squirrel_rect2_destructor);
-    sq_remove(v, -2);
-    sq_remove(v, -2);
-    sq_remove(v, -2);
+    push_rect2(v, instance->intersect(*with));
     return 1;
 }
 
@@ -390,18 +359,277 @@ static SQInteger squirrel_rect2_union(HSQUIRRELVM v) {
     sq_getinstanceup(v, 1, (SQUserPointer *)&instance, (SQUserPointer)"Rect2Tag", SQTrue);
     Rect2 * with;
     sq_getinstanceup(v, 2, (SQUserPointer *)&with, (SQUserPointer)"Rect2Tag", SQTrue);
-    sq_pushroottable(v);
-    sq_pushstring(v, _SC("Mousey"), -1);
-    sq_get(v, -2);
-    sq_pushstring(v, _SC("Rect2"), -1);
-    sq_get(v, -2);
-    sq_createinstance(v, -1);
-    Rect2 * result = new Rect2(instance->union_rect(*with));
-    sq_setinstanceup(v, -1, result);
-    sq_setreleasehook(v, -1, squirrel_rect2_destructor);
-    sq_remove(v, -2);
-    sq_remove(v, -2);
-    sq_remove(v, -2);
+    push_rect2(v, instance->union_rect(*with));
+    return 1;
+}
+
+static SQInteger squirrel_vector2array_destructor(SQUserPointer p, SQInteger SQ_UNUSED_ARG(size)) {
+    Vector2Array * instance = reinterpret_cast<Vector2Array *>(p);
+    delete instance;
+    return 0;
+}
+
+static SQInteger squirrel_vector2array_constructor(HSQUIRRELVM v) {
+    Vector2Array * instance;
+    if(sq_gettop(v) > 1 && sq_gettype(v, 2) == OT_INSTANCE) {
+        SQUserPointer data;
+        if(SQ_FAILED(sqstd_getblob(v, 2, &data)))
+            return sq_throwerror(v, _SC("Argument 1 not a blob"));
+        
+        instance = new Vector2Array();
+        instance->attach(data, sqstd_getblobsize(v, 2) / (2 * sizeof(double)));
+        sq_pushstring(v, _SC("_blob"), -1);
+        sq_push(v, 2);
+        sq_set(v, 1);
+    } else {
+        SQInteger count = 0;
+        if(sq_gettop(v) > 1 && SQ_FAILED(sq_getinteger(v, 2, &count)))
+            return sq_throwerror(v, _SC("Argument 1 not an integer or a blob"));
+        
+        if(count < 0)
+            return sq_throwerror(v, _SC("Count must not be negative"));
+        
+        instance = new Vector2Array(count);
+    }
+
+    sq_setinstanceup(v, 1, instance);
+    sq_setreleasehook(v, 1, squirrel_vector2array_destructor);
+    return 0;
+}
+
+static Vector2Array * get_vector2_array(HSQUIRRELVM v, SQInteger idx) {
+    Vector2Array * instance;
+    if(SQ_FAILED(sq_getinstanceup(v, idx, (SQUserPointer *)&instance, (SQUserPointer)"Vector2ArrayTag", SQTrue)))
+        return nullptr;
+    
+    if(instance->is_attached()) {
+        // The script may have resized the blob since the last call, moving its memory.
+        SQUserPointer data = nullptr;
+        sq_pushstring(v, _SC("_blob"), -1);
+        if(SQ_FAILED(sq_get(v, idx))) {
+            sq_throwerror(v, _SC("Attached blob is missing"));
+            return nullptr;
+        }
+
+        if(SQ_FAILED(sqstd_getblob(v, -1, &data))) {
+            sq_pop(v, 1);
+            sq_throwerror(v, _SC("Attached blob is no longer a blob"));
+            return nullptr;
+        }
+
+        instance->attach(data, sqstd_getblobsize(v, -1) / (2 * sizeof(double)));
+        sq_pop(v, 1);
+    }
+
+    return instance;
+}
+
+static SQInteger squirrel_vector2array_len(HSQUIRRELVM v) {
+    Vector2Array * instance = get_vector2_array(v, 1);
+    if(instance == nullptr)
+        return SQ_ERROR;
+    
+    sq_pushinteger(v, instance->size());
+    return 1;
+}
+
+static SQInteger squirrel_vector2array_resize(HSQUIRRELVM v) {
+    Vector2Array * instance = get_vector2_array(v, 1);
+    if(instance == nullptr)
+        return SQ_ERROR;
+    
+    SQInteger count;
+    if(SQ_FAILED(sq_getinteger(v, 2, &count)))
+        return sq_throwerror(v, _SC("Argument 1 not an integer"));
+    
+    if(count < 0)
+        return sq_throwerror(v, _SC("Count must not be negative"));
+    
+    if(instance->is_attached())
+        return sq_throwerror(v, _SC("Resize the blob instead"));
+    
+    instance->resize(count);
+    return 0;
+}
+
+static SQInteger squirrel_vector2array_get(HSQUIRRELVM v) {
+    Vector2Array * instance = get_vector2_array(v, 1);
+    if(instance == nullptr)
+        return SQ_ERROR;
+    
+    SQInteger index;
+    if(SQ_FAILED(sq_getinteger(v, 2, &index)))
+        return sq_throwerror(v, _SC("Argument 1 not an integer"));
+    
+    if(index < 0 || (size_t)index >= instance->size())
+        return sq_throwerror(v, _SC("Index out of range"));
+    
+    push_vector2(v, instance->get(index));
+    return 1;
+}
+
+static SQInteger squirrel_vector2array_set(HSQUIRRELVM v) {
+    Vector2Array * instance = get_vector2_array(v, 1);
+    if(instance == nullptr)
+        return SQ_ERROR;
+    
+    SQInteger index;
+    if(SQ_FAILED(sq_getinteger(v, 2, &index)))
+        return sq_throwerror(v, _SC("Argument 1 not an integer"));
+    
+    Vector2 * value;
+    if(SQ_FAILED(sq_getinstanceup(v, 3, (SQUserPointer *)&value, (SQUserPointer)"Vector2Tag", SQTrue)))
+        return SQ_ERROR;
+    
+    if(index < 0 || (size_t)index >= instance->size())
+        return sq_throwerror(v, _SC("Index out of range"));
+    
+    instance->set(index, *value);
+    return 0;
+}
+
+static SQInteger squirrel_vector2array_fill(HSQUIRRELVM v) {
+    Vector2Array * instance = get_vector2_array(v, 1);
+    if(instance == nullptr)
+        return SQ_ERROR;
+    
+    Vector2 * value;
+    if(SQ_FAILED(sq_getinstanceup(v, 2, (SQUserPointer *)&value, (SQUserPointer)"Vector2Tag", SQTrue)))
+        return SQ_ERROR;
+    
+    instance->fill(*value);
+    return 0;
+}
+
+static SQInteger squirrel_vector2array_add(HSQUIRRELVM v) {
+    Vector2Array * instance = get_vector2_array(v, 1);
+    if(instance == nullptr)
+        return SQ_ERROR;
+    
+    Vector2 * offset;
+    SQUserPointer tag;
+    if(SQ_SUCCEEDED(sq_gettypetag(v, 2, &tag)) && tag == (SQUserPointer)"Vector2ArrayTag") {
+        Vector2Array * other = get_vector2_array(v, 2);
+        if(other == nullptr)
+            return SQ_ERROR;
+        
+        instance->add(*other);
+    } else if(SQ_SUCCEEDED(sq_getinstanceup(v, 2, (SQUserPointer *)&offset, (SQUserPointer)"Vector2Tag", SQFalse)))
+        instance->add(*offset);
+    else
+        return sq_throwerror(v, _SC("Argument 1 not a Vector2 or a Vector2Array"));
+    
+    return 0;
+}
+
+static SQInteger squirrel_vector2array_scale(HSQUIRRELVM v) {
+    Vector2Array * instance = get_vector2_array(v, 1);
+    if(instance == nullptr)
+        return SQ_ERROR;
+    
+    SQFloat s;
+    if(SQ_FAILED(sq_getfloat(v, 2, &s)))
+        return sq_throwerror(v, _SC("Argument 1 not a float"));
+    
+    instance->scale(s);
+    return 0;
+}
+
+static SQInteger squirrel_vector2array_mad(HSQUIRRELVM v) {
+    Vector2Array * instance = get_vector2_array(v, 1);
+    if(instance == nullptr)
+        return SQ_ERROR;
+    
+    Vector2Array * other = get_vector2_array(v, 2);
+    if(other == nullptr)
+        return SQ_ERROR;
+    
+    SQFloat s;
+    if(SQ_FAILED(sq_getfloat(v, 3, &s)))
+        return sq_throwerror(v, _SC("Argument 2 not a float"));
+    
+    instance->mad(*other, s);
+    return 0;
+}
+
+static SQInteger squirrel_vector2array_normalize(HSQUIRRELVM v) {
+    Vector2Array * instance = get_vector2_array(v, 1);
+    if(instance == nullptr)
+        return SQ_ERROR;
+    
+    instance->normalize();
+    return 0;
+}
+
+static SQInteger squirrel_vector2array_lengths(HSQUIRRELVM v) {
+    Vector2Array * instance = get_vector2_array(v, 1);
+    if(instance == nullptr)
+        return SQ_ERROR;
+    
+    double * lengths = (double *)sqstd_createblob(v, instance->size() * sizeof(double));
+    instance->get_lengths(lengths);
+    return 1;
+}
+
+static SQInteger squirrel_vector2array_clamp(HSQUIRRELVM v) {
+    Vector2Array * instance = get_vector2_array(v, 1);
+    if(instance == nullptr)
+        return SQ_ERROR;
+    
+    Rect2 * rect;
+    if(SQ_FAILED(sq_getinstanceup(v, 2, (SQUserPointer *)&rect, (SQUserPointer)"Rect2Tag", SQTrue)))
+        return SQ_ERROR;
+    
+    instance->clamp(*rect);
+    return 0;
+}
+
+static SQInteger squirrel_vector2array_nearest(HSQUIRRELVM v) {
+    Vector2Array * instance = get_vector2_array(v, 1);
+    if(instance == nullptr)
+        return SQ_ERROR;
+    
+    Vector2 * point;
+    if(SQ_FAILED(sq_getinstanceup(v, 2, (SQUserPointer *)&point, (SQUserPointer)"Vector2Tag", SQTrue)))
+        return SQ_ERROR;
+    
+    sq_pushinteger(v, instance->nearest(*point));
+    return 1;
+}
+
+static SQInteger squirrel_vector2array_within(HSQUIRRELVM v) {
+    Vector2Array * instance = get_vector2_array(v, 1);
+    if(instance == nullptr)
+        return SQ_ERROR;
+    
+    Vector2 * point;
+    if(SQ_FAILED(sq_getinstanceup(v, 2, (SQUserPointer *)&point, (SQUserPointer)"Vector2Tag", SQTrue)))
+        return SQ_ERROR;
+    
+    SQFloat radius;
+    if(SQ_FAILED(sq_getfloat(v, 3, &radius)))
+        return sq_throwerror(v, _SC("Argument 2 not a float"));
+    
+    std::vector<size_t> indices;
+    instance->find_within(*point, radius, indices);
+    sq_newarray(v, 0);
+    for(size_t index : indices) {
+        sq_pushinteger(v, index);
+        sq_arrayappend(v, -2);
+    }
+
+    return 1;
+}
+
+static SQInteger squirrel_vector2array_toblob(HSQUIRRELVM v) {
+    Vector2Array * instance = get_vector2_array(v, 1);
+    if(instance == nullptr)
+        return SQ_ERROR;
+    
+    size_t count = instance->size();
+    double * data = (double *)sqstd_createblob(v, count * 2 * sizeof(double));
+    memcpy(data, instance->get_xs(), count * sizeof(double));
+    memcpy(data + count, instance->get_ys(), count * sizeof(double));
     return 1;
 }
 
@@ -412,6 +640,9 @@ void register_math_wrapper(HSQUIRRELVM v) {
     sq_pushstring(v, _SC("Vector2"), -1);
     sq_newclass(v, SQFalse);
     sq_settypetag(v, -1, (SQUserPointer)"Vector2Tag");
+    sq_setclassudsize(v, -1, sizeof(Vector2));
+    sq_getstackobj(v, -1, &vector2_class);
+    sq_addref(v, &vector2_class);
 
     sq_resetobject(&set_table);
     sq_pushstring(v, _SC("__setTable"), -1);
@@ -489,6 +720,31 @@ void register_math_wrapper(HSQUIRRELVM v) {
     sq_setparamscheck(v, 2, _SC("xx"));
     sq_newslot(v, -3, SQFalse);
 
+    sq_pushstring(v, _SC("set"), -1);
+    sq_newclosure(v, squirrel_vector2_set, 0);
+    sq_setparamscheck(v, 3, _SC("xnn"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("add_in_place"), -1);
+    sq_newclosure(v, squirrel_vector2_addinplace, 0);
+    sq_setparamscheck(v, 2, _SC("xx"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("scale_in_place"), -1);
+    sq_newclosure(v, squirrel_vector2_scaleinplace, 0);
+    sq_setparamscheck(v, 2, _SC("xn"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("mad"), -1);
+    sq_newclosure(v, squirrel_vector2_mad, 0);
+    sq_setparamscheck(v, 3, _SC("xxn"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("normalize_in_place"), -1);
+    sq_newclosure(v, squirrel_vector2_normalizeinplace, 0);
+    sq_setparamscheck(v, 1, _SC("x"));
+    sq_newslot(v, -3, SQFalse);
+
     sq_pushstring(v, _SC("_add"), -1);
     sq_newclosure(v, squirrel_vector2_add, 0);
     sq_setparamscheck(v, 2, _SC("xx"));
@@ -519,6 +775,9 @@ void register_math_wrapper(HSQUIRRELVM v) {
     sq_pushstring(v, _SC("Rect2"), -1);
     sq_newclass(v, SQFalse);
     sq_settypetag(v, -1, (SQUserPointer)"Rect2Tag");
+    sq_setclassudsize(v, -1, sizeof(Rect2));
+    sq_getstackobj(v, -1, &rect2_class);
+    sq_addref(v, &rect2_class);
 
     sq_resetobject(&set_table);
     sq_pushstring(v, _SC("__setTable"), -1);
@@ -587,4 +846,89 @@ void register_math_wrapper(HSQUIRRELVM v) {
     sq_newslot(v, -3, SQFalse);
 
     sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("Vector2Array"), -1);
+    sq_newclass(v, SQFalse);
+    sq_settypetag(v, -1, (SQUserPointer)"Vector2ArrayTag");
+
+    sq_pushstring(v, _SC("_blob"), -1);
+    sq_pushnull(v);
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("constructor"), -1);
+    sq_newclosure(v, squirrel_vector2array_constructor, 0);
+    sq_setparamscheck(v, -1, _SC("xi|x"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("len"), -1);
+    sq_newclosure(v, squirrel_vector2array_len, 0);
+    sq_setparamscheck(v, 1, _SC("x"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("resize"), -1);
+    sq_newclosure(v, squirrel_vector2array_resize, 0);
+    sq_setparamscheck(v, 2, _SC("xi"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("get"), -1);
+    sq_newclosure(v, squirrel_vector2array_get, 0);
+    sq_setparamscheck(v, 2, _SC("xi"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("set"), -1);
+    sq_newclosure(v, squirrel_vector2array_set, 0);
+    sq_setparamscheck(v, 3, _SC("xix"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("fill"), -1);
+    sq_newclosure(v, squirrel_vector2array_fill, 0);
+    sq_setparamscheck(v, 2, _SC("xx"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("add"), -1);
+    sq_newclosure(v, squirrel_vector2array_add, 0);
+    sq_setparamscheck(v, 2, _SC("xx"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("scale"), -1);
+    sq_newclosure(v, squirrel_vector2array_scale, 0);
+    sq_setparamscheck(v, 2, _SC("xn"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("mad"), -1);
+    sq_newclosure(v, squirrel_vector2array_mad, 0);
+    sq_setparamscheck(v, 3, _SC("xxn"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("normalize"), -1);
+    sq_newclosure(v, squirrel_vector2array_normalize, 0);
+    sq_setparamscheck(v, 1, _SC("x"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("lengths"), -1);
+    sq_newclosure(v, squirrel_vector2array_lengths, 0);
+    sq_setparamscheck(v, 1, _SC("x"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("clamp"), -1);
+    sq_newclosure(v, squirrel_vector2array_clamp, 0);
+    sq_setparamscheck(v, 2, _SC("xx"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("nearest"), -1);
+    sq_newclosure(v, squirrel_vector2array_nearest, 0);
+    sq_setparamscheck(v, 2, _SC("xx"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("within"), -1);
+    sq_newclosure(v, squirrel_vector2array_within, 0);
+    sq_setparamscheck(v, 3, _SC("xxn"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_pushstring(v, _SC("to_blob"), -1);
+    sq_newclosure(v, squirrel_vector2array_toblob, 0);
+    sq_setparamscheck(v, 1, _SC("x"));
+    sq_newslot(v, -3, SQFalse);
+
+    sq_newslot(v, -3, SQFalse);
 }
\ No newline at end of file
@@ -24,10 +24,13 @@
 #ifndef WRAPPER_MATH_H
 #define WRAPPER_MATH_H
 
+#include "math/rect2.h"
+#include "math/vector2.h"
 #include <squirrel.h>
 
-extern SQInteger squirrel_vector2_destructor(SQUserPointer p, SQInteger size);
-extern SQInteger squirrel_rect2_destructor(SQUserPointer p, SQInteger size);
+Vector2 * push_vector2(HSQUIRRELVM v, double x, double y);
+Vector2 * push_vector2(HSQUIRRELVM v, const Vector2 & value);
+Rect2 * push_rect2(HSQUIRRELVM v, const Rect2 & value);
 
 void register_math_wrapper(HSQUIRRELVM v);
 
@@ -38,18 +38,7 @@ enum MouseButton {
 static SQInteger squirrel_mouse_getposition(HSQUIRRELVM v) {
     int x, y;
     SDL_GetMouseState(&x, &y);
-    sq_pushroottable(v);
-    sq_pushstring(v, _SC("Mousey"), -1);
-    sq_get(v, -2);
-    sq_pushstring(v, _SC("Vector2"), -1);
-    sq_get(v, -2);
-    sq_createinstance(v, -1);
-    Vector2 * vector = new Vector2(x, y);
-    sq_setinstanceup(v, -1, vector);
-    sq_setreleasehook(v, -1, squirrel_vector2_destructor);
-    sq_remove(v, -2);
-    sq_remove(v, -2);
-    sq_remove(v, -2);
+    push_vector2(v, x, y);
     return 1;
 }
 
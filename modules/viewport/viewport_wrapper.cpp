@@ -29,21 +29,15 @@
 static SQInteger squirrel_viewport_getsize(HSQUIRRELVM v) {
     int w, h;
     SDL_GetWindowSize(Engine::get_singleton()->get_window()->get_window(), &w, &h);
-    sq_pushroottable(v);
-    sq_pushstring(v, _SC("Mousey"), -1);
-    sq_get(v, -2);
-    sq_pushstring(v, _SC("Vector2"), -1);
-    sq_get(v, -2);
-    sq_createinstance(v, -1);
-    Vector2 * result = new Vector2(w, h);
-    sq_setinstanceup(v, -1, result);
-    sq_setreleasehook(v, -1, squirrel_vector2_destructor);
-    sq_remove(v, -2);
-    sq_remove(v, -2);
-    sq_remove(v, -2);
+    push_vector2(v, w, h);
     return 1;
 }
 
+static SQInteger squirrel_viewport_close(HSQUIRRELVM v) {
+    Engine::get_singleton()->get_window()->close_window();
+    return 0;
+}
+
 void register_viewport_wrapper(HSQUIRRELVM v) {
     sq_pushstring(v, _SC("Viewport"), -1);
     sq_newtable(v);
@@ -53,5 +47,10 @@ void register_viewport_wrapper(HSQUIRRELVM v) {
     sq_setparamscheck(v, 1, _SC("."));
     sq_newslot(v, -3, SQFalse);
 
+    sq_pushstring(v, _SC("close"), -1);
+    sq_newclosure(v, squirrel_viewport_close, 0);
+    sq_setparamscheck(v, 1, _SC("."));
+    sq_newslot(v, -3, SQFalse);
+
     sq_newslot(v, -3, SQFalse);
 }
\ No newline at end of file
@@ -55,6 +55,16 @@ Engine::Engine() {
         fout << emitter.c_str();
     }
 
+    YAML::Node project = YAML::LoadFile("project.yaml");
+    std::string backend = project["renderer"] && project["renderer"]["backend"] ? project["renderer"]["backend"].as<std::string>() : "gl";
+    if(getenv("MOUSEY_RENDER_BACKEND") != nullptr)
+        backend = getenv("MOUSEY_RENDER_BACKEND");
+    
+    // Headless backends must not need a display, so SDL only gets a dummy video driver.
+    bool headless = backend == "null" || backend == "offscreen";
+    if(headless)
+        SDL_setenv("SDL_VIDEODRIVER", "dummy", 0);
+
     if(SDL_Init(SDL_INIT_EVERYTHING) < 0) {
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to initialize SDL! (%s)", SDL_GetError());
         return;
@@ -81,7 +91,6 @@ Engine::Engine() {
         return;
     }
 
-    YAML::Node project = YAML::LoadFile("project.yaml");
     YAML::Node window_node = project["window"];
     std::string title = window_node["title"].as<std::string>();
     std::string icon = window_node["icon"].as<std::string>();
@@ -91,10 +100,21 @@ Engine::Engine() {
     bool always_on_top = window_node["always_on_top"].as<bool>();
     bool borderless = window_node["borderless"].as<bool>();
     bool fullscreen = window_node["fullscreen"].as<bool>();
-    window = new Window(title.c_str(), w, h, icon.c_str(), resizable, always_on_top, borderless, fullscreen);
+    window = new Window(title.c_str(), w, h, icon.c_str(), resizable, always_on_top, borderless, fullscreen, !headless);
+    device = create_render_device(backend, window);
+    if(device == nullptr) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to initialize the %s render backend, falling back to null!", backend.c_str());
+        device = create_render_device("null", window);
+    }
+
+    renderer = new Renderer(device);
+    vm.load("main.nut");
 }
 
 Engine::~Engine() {
+    vm.close();
+    delete renderer;
+    delete device;
     delete window;
     Sound_Quit();
     TTF_Quit();
@@ -107,43 +127,43 @@ Engine * Engine::get_singleton() {
 }
 
 void Engine::run() {
-    glEnable(GL_TEXTURE_2D);
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     current_keyboard_state = (uint8_t *)calloc(SDL_NUM_SCANCODES, sizeof(uint8_t));
     previous_keyboard_state = (uint8_t *)calloc(SDL_NUM_SCANCODES, sizeof(uint8_t));
-    vm.call_func_without_return("initialize");
+    ScriptCallback initialize, update, physics_update, render;
+    vm.bind_callback(initialize, _SC("initialize"));
+    vm.bind_callback(update, _SC("update"));
+    vm.bind_callback(physics_update, _SC("physics_update"));
+    vm.bind_callback(render, _SC("render"));
+    vm.call(initialize);
     uint64_t last_frame_time = SDL_GetTicks64();
     while(!window->should_close()) {
         event.poll();
+        vm.refresh_callback(update);
+        vm.refresh_callback(physics_update);
+        vm.refresh_callback(render);
+        renderer->get_loader()->update();
         uint64_t current_time = SDL_GetTicks64();
         double dt = (current_time - last_frame_time) / 1000.0;
-        vm.call_func_without_return("update", dt);
+        vm.call(update, dt);
         accumulator += dt;
         while(accumulator >= fixed_dt) {
-            vm.call_func_without_return("physics_update", fixed_dt);
+            vm.call(physics_update, fixed_dt);
             accumulator -= fixed_dt;
         }
 
         memcpy(previous_keyboard_state, current_keyboard_state, SDL_NUM_SCANCODES);
         previous_mouse_state = current_mouse_state;
         last_frame_time = current_time;
-        glClearColor(0, 0, 0, 0);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        renderer->get_profiler()->begin_frame();
         int w, h;
         SDL_GetWindowSize(window->get_window(), &w, &h);
-        glViewport(0, 0, w, h);
-        glMatrixMode(GL_PROJECTION);
-        glLoadIdentity();
-        glOrtho(0, w, h, 0, -1, 1);
-        glMatrixMode(GL_MODELVIEW);
-        glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
-        vm.call_func_without_return("render");
-        window->swap();
+        renderer->begin_frame(w, h);
+        vm.call(render);
+        renderer->flush();
+        renderer->get_profiler()->end_frame();
+        device->end_frame();
     }
 
     free(current_keyboard_state);
     free(previous_keyboard_state);
-    glDisable(GL_BLEND);
-    glDisable(GL_TEXTURE_2D);
 }
\ No newline at end of file
@@ -0,0 +1,61 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#include "graphics/camera2d.h"
+#include <math.h>
+
+void Camera2D::get_projection(double width, double height, float matrix[16]) const {
+    double c = cos(rotation);
+    double s = sin(rotation);
+    double sx = 2 * zoom / width;
+    double sy = 2 * zoom / height;
+    for(int i = 0; i < 16; i++)
+        matrix[i] = 0;
+    
+    matrix[0] = sx * c;
+    matrix[1] = sy * s;
+    matrix[4] = sx * s;
+    matrix[5] = -sy * c;
+    matrix[10] = -1;
+    matrix[12] = -sx * (c * position.x + s * position.y);
+    matrix[13] = sy * (-s * position.x + c * position.y);
+    matrix[15] = 1;
+}
+
+Rect2 Camera2D::get_visible_rect(double width, double height) const {
+    double half_width = width / (2 * zoom);
+    double half_height = height / (2 * zoom);
+    double c = fabs(cos(rotation));
+    double s = fabs(sin(rotation));
+    double extent_x = c * half_width + s * half_height;
+    double extent_y = s * half_width + c * half_height;
+    return Rect2(position.x - extent_x, position.y - extent_y, extent_x * 2, extent_y * 2);
+}
+
+Vector2 Camera2D::screen_to_world(const Vector2 & point, double width, double height) const {
+    double x = (point.x - width / 2) / zoom;
+    double y = (point.y - height / 2) / zoom;
+    double c = cos(rotation);
+    double s = sin(rotation);
+    return Vector2(position.x + x * c - y * s, position.y + x * s + y * c);
+}
\ No newline at end of file
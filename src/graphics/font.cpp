@@ -22,14 +22,378 @@
 /******************************************************************************/
 
 #include "graphics/font.h"
+#include "graphics/renderer.h"
+#include <math.h>
 
-Font::Font(const char * path, int size) {
-    font = TTF_OpenFont(path, size);
-    if(font == nullptr)
-        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Unable to load font %s! (%s)", path, TTF_GetError());
+#define FONT_PAGE_SIZE 512
+#define FONT_TEXT_CACHE_SIZE 256
+
+static Uint32 next_codepoint(const char *& text) {
+    const unsigned char * s = (const unsigned char *)text;
+    Uint32 codepoint;
+    int length;
+    if(s[0] < 0x80) {
+        codepoint = s[0];
+        length = 1;
+    } else if((s[0] & 0xE0) == 0xC0) {
+        codepoint = s[0] & 0x1F;
+        length = 2;
+    } else if((s[0] & 0xF0) == 0xE0) {
+        codepoint = s[0] & 0x0F;
+        length = 3;
+    } else if((s[0] & 0xF8) == 0xF0) {
+        codepoint = s[0] & 0x07;
+        length = 4;
+    } else {
+        text++;
+        return 0xFFFD;
+    }
+
+    for(int i = 1; i < length; i++) {
+        if((s[i] & 0xC0) != 0x80) {
+            text += i;
+            return 0xFFFD;
+        }
+
+        codepoint = (codepoint << 6) | (s[i] & 0x3F);
+    }
+
+    text += length;
+    return codepoint;
+}
+
+static void transform_distance(const std::vector<Uint8> & mask, int width, int height, Uint8 target, std::vector<float> & distance) {
+    static const int offsets[8][2] = { { -1, -1 }, { 0, -1 }, { 1, -1 }, { -1, 0 }, { 1, 0 }, { -1, 1 }, { 0, 1 }, { 1, 1 } };
+    std::vector<int> nearest(width * height * 2);
+    distance.assign(width * height, 1e9f);
+    for(int i = 0; i < width * height; i++) {
+        if(mask[i] == target) {
+            distance[i] = 0;
+            nearest[i * 2] = i % width;
+            nearest[i * 2 + 1] = i / width;
+        }
+    }
+
+    auto relax = [&](int x, int y, int dx, int dy) {
+        int nx = x + dx;
+        int ny = y + dy;
+        if(nx < 0 || ny < 0 || nx >= width || ny >= height)
+            return;
+        
+        int i = y * width + x;
+        int n = ny * width + nx;
+        if(distance[n] + (dx && dy ? 1.4142f : 1.0f) >= distance[i])
+            return;
+        
+        nearest[i * 2] = nearest[n * 2];
+        nearest[i * 2 + 1] = nearest[n * 2 + 1];
+        distance[i] = hypotf(x - nearest[i * 2], y - nearest[i * 2 + 1]);
+    };
+
+    for(int y = 0; y < height; y++)
+        for(int x = 0; x < width; x++)
+            for(int k = 0; k < 4; k++)
+                relax(x, y, offsets[k][0], offsets[k][1]);
+    
+    for(int y = height - 1; y >= 0; y--)
+        for(int x = width - 1; x >= 0; x--)
+            for(int k = 4; k < 8; k++)
+                relax(x, y, offsets[k][0], offsets[k][1]);
+}
+
+static void build_distance_field(SDL_Surface * surface, std::vector<Uint32> & pixels) {
+    int width = surface->w + FONT_SDF_SPREAD * 2;
+    int height = surface->h + FONT_SDF_SPREAD * 2;
+    std::vector<Uint8> inside(width * height, 0);
+    for(int y = 0; y < surface->h; y++) {
+        const Uint32 * row = (const Uint32 *)((const Uint8 *)surface->pixels + y * surface->pitch);
+        for(int x = 0; x < surface->w; x++)
+            inside[(y + FONT_SDF_SPREAD) * width + x + FONT_SDF_SPREAD] = (row[x] >> 24) >= 128;
+    }
+
+    std::vector<float> to_outside;
+    std::vector<float> to_inside;
+    transform_distance(inside, width, height, 0, to_outside);
+    transform_distance(inside, width, height, 1, to_inside);
+    pixels.resize(width * height);
+    for(int i = 0; i < width * height; i++) {
+        float distance = inside[i] ? to_outside[i] - 0.5f : 0.5f - to_inside[i];
+        float value = 0.5f + distance / (FONT_SDF_SPREAD * 2);
+        value = value < 0 ? 0 : value > 1 ? 1 : value;
+        pixels[i] = (Uint32)(value * 255 + 0.5f) << 24 | 0xFFFFFF;
+    }
 }
 
+Font::Font(Renderer * renderer, const std::string & path, const void * data, size_t data_size, int size, bool sdf) : renderer(renderer), path(path), data(data), data_size(data_size), size(size), sdf(sdf), packer(FONT_PAGE_SIZE, FONT_PAGE_SIZE) {}
+
+Font::Font(Font * face, int size) : renderer(face->renderer), path(face->path), data(nullptr), data_size(0), size(size), sdf(true), face(face), packer(FONT_PAGE_SIZE, FONT_PAGE_SIZE) {}
+
 Font::~Font() {
+    // Batches queued this frame may still sample the pages.
+    for(GLuint page : pages)
+        renderer->release_texture(page);
+    
     if(font)
         TTF_CloseFont(font);
+}
+
+bool Font::open() {
+    if(font == nullptr && !failed) {
+        font = TTF_OpenFontRW(SDL_RWFromConstMem(data, data_size), 1, size);
+        failed = font == nullptr;
+        if(failed)
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Unable to load font %s! (%s)", path.c_str(), TTF_GetError());
+    }
+
+    return font != nullptr;
+}
+
+const Font::Glyph & Font::get_glyph(Uint32 codepoint) {
+    auto it = glyphs.find(codepoint);
+    if(it != glyphs.end())
+        return it->second;
+    
+    Glyph glyph = { 0, { 0, 0, 0, 0 }, 0, 0 };
+    int minx, maxx, miny, maxy, advance;
+    if(TTF_GlyphMetrics32(font, codepoint, &minx, &maxx, &miny, &maxy, &advance) == 0)
+        glyph.offset = minx < 0 ? minx : 0;
+    
+    SDL_Surface * surface = TTF_RenderGlyph32_Blended(font, codepoint, { 255, 255, 255, 255 });
+    if(surface != nullptr) {
+        std::vector<Uint32> field;
+        const void * pixels = surface->pixels;
+        int w = surface->w;
+        int h = surface->h;
+        int row_length = surface->pitch / 4;
+        if(sdf) {
+            build_distance_field(surface, field);
+            pixels = field.data();
+            w += FONT_SDF_SPREAD * 2;
+            h += FONT_SDF_SPREAD * 2;
+            row_length = w;
+            glyph.offset -= FONT_SDF_SPREAD;
+            glyph.top = -FONT_SDF_SPREAD;
+        }
+
+        SDL_Rect rect;
+        RenderDevice * device = renderer->get_device();
+        bool packed = packer.pack(w + 1, h + 1, rect);
+        if(!packed || pages.empty()) {
+            std::vector<Uint32> blank(FONT_PAGE_SIZE * FONT_PAGE_SIZE, 0);
+            pages.push_back(device->create_texture(FONT_PAGE_SIZE, FONT_PAGE_SIZE, GL_RGBA, GL_UNSIGNED_BYTE, blank.data()));
+            device->set_texture_program(pages.back(), sdf ? PROGRAM_SDF : PROGRAM_TEXT);
+            if(!packed) {
+                packer.clear();
+                packed = packer.pack(w + 1, h + 1, rect);
+            }
+        }
+
+        if(packed) {
+            glyph.texture = pages.back();
+            glyph.rect = { rect.x, rect.y, w, h };
+            device->update_texture(glyph.texture, rect.x, rect.y, w, h, GL_BGRA, GL_UNSIGNED_INT_8_8_8_8_REV, pixels, row_length);
+        } else
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Glyph U+%04X does not fit in a font page!", codepoint);
+        
+        SDL_FreeSurface(surface);
+    }
+
+    return glyphs.emplace(codepoint, glyph).first->second;
+}
+
+int Font::get_advance(Uint32 codepoint) {
+    auto it = advances.find(codepoint);
+    if(it != advances.end())
+        return it->second;
+    
+    int minx, maxx, miny, maxy, advance;
+    if(TTF_GlyphMetrics32(font, codepoint, &minx, &maxx, &miny, &maxy, &advance) != 0)
+        advance = 0;
+    
+    advances.emplace(codepoint, advance);
+    return advance;
+}
+
+int Font::get_kerning(Uint32 previous, Uint32 codepoint) {
+    uint64_t pair = (uint64_t)previous << 32 | codepoint;
+    auto it = kernings.find(pair);
+    if(it != kernings.end())
+        return it->second;
+    
+    int kerning = TTF_GetFontKerningSizeGlyphs32(font, previous, codepoint);
+    kernings.emplace(pair, kerning);
+    return kerning;
+}
+
+void Font::build_text(const char * text, SDL_Color color, TextMesh & mesh) {
+    mesh.clear();
+    Font * source = face ? face : this;
+    if(!source->open())
+        return;
+    
+    double scale = (double)size / source->size;
+    double x = 0;
+    float min_x = 0;
+    float min_y = 0;
+    float max_x = 0;
+    float max_y = 0;
+    Uint32 previous = 0;
+    while(*text) {
+        Uint32 codepoint = next_codepoint(text);
+        if(previous)
+            x += source->get_kerning(previous, codepoint) * scale;
+        
+        const Glyph & glyph = source->get_glyph(codepoint);
+        if(glyph.texture) {
+            float x0 = x + glyph.offset * scale;
+            float y0 = glyph.top * scale;
+            float x1 = x0 + glyph.rect.w * scale;
+            float y1 = y0 + glyph.rect.h * scale;
+            float u0 = (float)glyph.rect.x / FONT_PAGE_SIZE;
+            float v0 = (float)glyph.rect.y / FONT_PAGE_SIZE;
+            float u1 = (float)(glyph.rect.x + glyph.rect.w) / FONT_PAGE_SIZE;
+            float v1 = (float)(glyph.rect.y + glyph.rect.h) / FONT_PAGE_SIZE;
+            if(mesh.runs.empty()) {
+                min_x = x0;
+                min_y = y0;
+                max_x = x1;
+                max_y = y1;
+            }
+
+            min_x = fminf(min_x, x0);
+            min_y = fminf(min_y, y0);
+            max_x = fmaxf(max_x, x1);
+            max_y = fmaxf(max_y, y1);
+            if(mesh.runs.empty() || mesh.runs.back().texture != glyph.texture)
+                mesh.runs.push_back({ glyph.texture, (GLint)mesh.vertices.size(), 0 });
+            
+            mesh.vertices.push_back({ x0, y0, u0, v0, color.r, color.g, color.b, color.a });
+            mesh.vertices.push_back({ x1, y0, u1, v0, color.r, color.g, color.b, color.a });
+            mesh.vertices.push_back({ x1, y1, u1, v1, color.r, color.g, color.b, color.a });
+            mesh.vertices.push_back({ x0, y0, u0, v0, color.r, color.g, color.b, color.a });
+            mesh.vertices.push_back({ x1, y1, u1, v1, color.r, color.g, color.b, color.a });
+            mesh.vertices.push_back({ x0, y1, u0, v1, color.r, color.g, color.b, color.a });
+            mesh.runs.back().count += 6;
+        }
+
+        x += source->get_advance(codepoint) * scale;
+        previous = codepoint;
+    }
+
+    mesh.width = x;
+    mesh.height = TTF_FontHeight(source->font) * scale;
+    mesh.bounds = Rect2(min_x, min_y, max_x - min_x, max_y - min_y);
+}
+
+void Font::draw_text(Renderer * renderer, const char * text, const Vector2 & position) {
+    auto it = cache_index.find(text);
+    if(it != cache_index.end())
+        cache.splice(cache.begin(), cache, it->second);
+    else {
+        if(cache.size() >= FONT_TEXT_CACHE_SIZE) {
+            cache_index.erase(cache.back().first);
+            cache.pop_back();
+        }
+
+        cache.emplace_front(text, TextMesh());
+        build_text(text, { 255, 255, 255, 255 }, cache.front().second);
+        cache_index.emplace(cache.front().first, cache.begin());
+    }
+
+    cache.front().second.draw(renderer, position);
+}
+
+double Font::measure_line(const char * start, const char * end) {
+    Font * source = face ? face : this;
+    int width = 0;
+    Uint32 previous = 0;
+    while(start < end) {
+        Uint32 codepoint = next_codepoint(start);
+        if(previous)
+            width += source->get_kerning(previous, codepoint);
+        
+        width += source->get_advance(codepoint);
+        previous = codepoint;
+    }
+
+    return width * ((double)size / source->size);
+}
+
+Vector2 Font::measure_text(const char * text) {
+    std::vector<TextLine> lines;
+    layout_text(text, 0, ALIGN_LEFT, lines);
+    if(lines.empty())
+        return Vector2(0, 0);
+    
+    Font * source = face ? face : this;
+    double width = 0;
+    for(const TextLine & line : lines)
+        width = line.width > width ? line.width : width;
+    
+    return Vector2(width, lines.back().y + TTF_FontHeight(source->font) * ((double)size / source->size));
+}
+
+void Font::layout_text(const char * text, double max_width, TextAlign align, std::vector<TextLine> & lines) {
+    lines.clear();
+    Font * source = face ? face : this;
+    if(!source->open())
+        return;
+    
+    double scale = (double)size / source->size;
+    double line_height = TTF_FontLineSkip(source->font) * scale;
+    const char * line_start = text;
+    const char * space = nullptr;
+    double space_width = 0;
+    double width = 0;
+    Uint32 previous = 0;
+    auto add_line = [&](const char * end, double line_width) {
+        lines.push_back({ (size_t)(line_start - text), (size_t)(end - line_start), 0, lines.size() * line_height, line_width });
+    };
+
+    const char * cursor = text;
+    while(true) {
+        const char * at = cursor;
+        if(*cursor == '\0' || *cursor == '\n') {
+            add_line(at, width);
+            if(*cursor == '\0')
+                break;
+            
+            line_start = ++cursor;
+            space = nullptr;
+            width = 0;
+            previous = 0;
+            continue;
+        }
+
+        Uint32 codepoint = next_codepoint(cursor);
+        double advance = ((previous ? source->get_kerning(previous, codepoint) : 0) + source->get_advance(codepoint)) * scale;
+        previous = codepoint;
+        if(codepoint == ' ') {
+            space = at;
+            space_width = width;
+        } else if(max_width > 0 && width + advance > max_width && at > line_start) {
+            if(space != nullptr) {
+                add_line(space, space_width);
+                line_start = space + 1;
+            } else {
+                add_line(at, width);
+                line_start = at;
+            }
+
+            space = nullptr;
+            width = measure_line(line_start, cursor);
+            continue;
+        }
+
+        width += advance;
+    }
+
+    double reference = max_width;
+    if(reference <= 0)
+        for(const TextLine & line : lines)
+            reference = line.width > reference ? line.width : reference;
+    
+    if(align != ALIGN_LEFT)
+        for(TextLine & line : lines)
+            line.x = (reference - line.width) * (align == ALIGN_CENTER ? 0.5 : 1.0);
 }
\ No newline at end of file
@@ -0,0 +1,148 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#include "graphics/font_registry.h"
+#include "graphics/font.h"
+#include <SDL2/SDL.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+FontRegistry::~FontRegistry() {
+    clear();
+}
+
+void FontRegistry::clear() {
+    for(auto & pair : fonts)
+        delete pair.second.font;
+    
+    for(auto & pair : files)
+        munmap(pair.second.data, pair.second.size);
+    
+    fonts.clear();
+    files.clear();
+    unused.clear();
+    default_font = nullptr;
+    default_font_loaded = false;
+}
+
+FontRegistry::FontFile * FontRegistry::map_file(const std::string & path) {
+    auto it = files.find(path);
+    if(it != files.end())
+        return &it->second;
+    
+    int fd = open(path.c_str(), O_RDONLY);
+    if(fd == -1) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Unable to open font %s!", path.c_str());
+        return nullptr;
+    }
+
+    struct stat info;
+    if(fstat(fd, &info) == -1 || info.st_size == 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Unable to read font %s!", path.c_str());
+        close(fd);
+        return nullptr;
+    }
+
+    void * data = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(data == MAP_FAILED) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Unable to map font %s!", path.c_str());
+        return nullptr;
+    }
+
+    return &files.emplace(path, FontFile{ data, (size_t)info.st_size, 0 }).first->second;
+}
+
+void FontRegistry::unmap_file(const std::string & path) {
+    auto it = files.find(path);
+    if(it == files.end() || --it->second.references > 0)
+        return;
+    
+    munmap(it->second.data, it->second.size);
+    files.erase(it);
+}
+
+void FontRegistry::evict() {
+    while(unused.size() > FONT_REGISTRY_MAX_UNUSED) {
+        Font * font = unused.back();
+        unused.pop_back();
+        std::string path = font->get_path();
+        Font * face = font->get_face();
+        fonts.erase({ path, font->get_size(), font->is_sdf() });
+        delete font;
+        if(face != nullptr)
+            release(face);
+        else
+            unmap_file(path);
+    }
+}
+
+Font * FontRegistry::acquire(const std::string & path, int size, bool sdf) {
+    auto it = fonts.find({ path, size, sdf });
+    if(it != fonts.end()) {
+        if(it->second.references++ == 0)
+            unused.erase(it->second.unused);
+        
+        return it->second.font;
+    }
+
+    Font * font;
+    if(sdf && size != FONT_SDF_SIZE) {
+        Font * face = acquire(path, FONT_SDF_SIZE, true);
+        if(face == nullptr)
+            return nullptr;
+        
+        font = new Font(face, size);
+    } else {
+        FontFile * file = map_file(path);
+        if(file == nullptr)
+            return nullptr;
+        
+        file->references++;
+        font = new Font(renderer, path, file->data, file->size, size, sdf);
+    }
+
+    fonts.emplace(std::make_tuple(path, size, sdf), Entry{ font, 1, unused.end() });
+    return font;
+}
+
+void FontRegistry::release(Font * font) {
+    auto it = fonts.find({ font->get_path(), font->get_size(), font->is_sdf() });
+    if(it == fonts.end() || --it->second.references > 0)
+        return;
+    
+    unused.push_front(font);
+    it->second.unused = unused.begin();
+    evict();
+}
+
+Font * FontRegistry::get_default_font() {
+    if(!default_font_loaded) {
+        default_font = acquire(FONT_DEFAULT_PATH, FONT_DEFAULT_SIZE);
+        default_font_loaded = true;
+    }
+    
+    return default_font;
+}
\ No newline at end of file
@@ -0,0 +1,454 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#include "graphics/gl_device.h"
+#include "graphics/shader_program.h"
+#include "viewport/window.h"
+#include <SDL2/SDL.h>
+
+static const char * vertex_source =
+    "#version 140\n"
+    "layout(std140) uniform Projection { mat4 projection; vec2 offset; };\n"
+    "in vec2 position;\n"
+    "in vec2 uv;\n"
+    "in vec4 color;\n"
+    "out vec2 frag_uv;\n"
+    "out vec4 frag_color;\n"
+    "void main() {\n"
+    "    frag_uv = uv;\n"
+    "    frag_color = color;\n"
+    "    gl_Position = projection * vec4(position + offset, 0.0, 1.0);\n"
+    "}\n";
+
+static const char * instanced_vertex_source =
+    "#version 140\n"
+    "layout(std140) uniform Projection { mat4 projection; vec2 offset; };\n"
+    "in vec2 center;\n"
+    "in vec2 axis_u;\n"
+    "in vec2 axis_v;\n"
+    "in vec4 uv_rect;\n"
+    "in vec4 color;\n"
+    "out vec2 frag_uv;\n"
+    "out vec4 frag_color;\n"
+    "const vec2 corners[6] = vec2[6](vec2(-1.0, -1.0), vec2(1.0, -1.0), vec2(1.0, 1.0), vec2(-1.0, -1.0), vec2(1.0, 1.0), vec2(-1.0, 1.0));\n"
+    "void main() {\n"
+    "    vec2 corner = corners[gl_VertexID];\n"
+    "    frag_uv = mix(uv_rect.xy, uv_rect.zw, corner * 0.5 + 0.5);\n"
+    "    frag_color = color;\n"
+    "    gl_Position = projection * vec4(center + axis_u * corner.x + axis_v * corner.y + offset, 0.0, 1.0);\n"
+    "}\n";
+
+static const char * fragment_sources[PROGRAM_MAX] = {
+    "#version 140\n"
+    "uniform sampler2D image;\n"
+    "in vec2 frag_uv;\n"
+    "in vec4 frag_color;\n"
+    "out vec4 fragment;\n"
+    "void main() {\n"
+    "    fragment = texture(image, frag_uv) * frag_color;\n"
+    "}\n",
+    "#version 140\n"
+    "in vec4 frag_color;\n"
+    "out vec4 fragment;\n"
+    "void main() {\n"
+    "    fragment = frag_color;\n"
+    "}\n",
+    "#version 140\n"
+    "uniform sampler2D image;\n"
+    "in vec2 frag_uv;\n"
+    "in vec4 frag_color;\n"
+    "out vec4 fragment;\n"
+    "void main() {\n"
+    "    fragment = vec4(frag_color.rgb, frag_color.a * texture(image, frag_uv).a);\n"
+    "}\n",
+    "#version 140\n"
+    "uniform sampler2D image;\n"
+    "in vec2 frag_uv;\n"
+    "in vec4 frag_color;\n"
+    "out vec4 fragment;\n"
+    "void main() {\n"
+    "    float distance = texture(image, frag_uv).a;\n"
+    "    float width = max(fwidth(distance), 0.0001);\n"
+    "    fragment = vec4(frag_color.rgb, frag_color.a * smoothstep(0.5 - width, 0.5 + width, distance));\n"
+    "}\n"
+};
+
+static const char * program_names[PROGRAM_MAX] = { "sprite", "shape", "text", "sdf" };
+static const char * instanced_program_names[PROGRAM_MAX] = { "sprite_instanced", "shape_instanced", "text_instanced", "sdf_instanced" };
+
+static void set_program_bindings(GLuint program) {
+    GLuint block = glGetUniformBlockIndex(program, "Projection");
+    if(block != GL_INVALID_INDEX)
+        glUniformBlockBinding(program, block, 0);
+    
+    glUseProgram(program);
+    GLint image = glGetUniformLocation(program, "image");
+    if(image != -1)
+        glUniform1i(image, 0);
+}
+
+static void set_attribute_divisor(GLuint attribute) {
+    if(GLEW_VERSION_3_3)
+        glVertexAttribDivisor(attribute, 1);
+    else
+        glVertexAttribDivisorARB(attribute, 1);
+}
+
+GLDevice::~GLDevice() {
+    release();
+}
+
+bool GLDevice::initialize() {
+    if(window->get_context() == nullptr)
+        return false;
+    
+    return create_pipeline();
+}
+
+bool GLDevice::create_pipeline() {
+    for(int i = 0; i < PROGRAM_MAX; i++) {
+        programs[i] = load_shader_program(program_names[i], vertex_source, fragment_sources[i]);
+        if(programs[i] == 0)
+            return false;
+        
+        set_program_bindings(programs[i]);
+    }
+
+    instancing = GLEW_VERSION_3_3 || GLEW_ARB_instanced_arrays;
+    for(int i = 0; i < PROGRAM_MAX && instancing; i++) {
+        instanced_programs[i] = load_shader_program(instanced_program_names[i], instanced_vertex_source, fragment_sources[i]);
+        if(instanced_programs[i] == 0)
+            instancing = false;
+        else
+            set_program_bindings(instanced_programs[i]);
+    }
+
+    if(instancing) {
+        glGenBuffers(1, &instance_buffer);
+        glGenVertexArrays(1, &instance_array);
+        glBindVertexArray(instance_array);
+        glBindBuffer(GL_ARRAY_BUFFER, instance_buffer);
+        const GLuint attributes[] = { ATTRIBUTE_CENTER, ATTRIBUTE_AXIS_U, ATTRIBUTE_AXIS_V, ATTRIBUTE_UV_RECT, ATTRIBUTE_COLOR };
+        for(GLuint attribute : attributes) {
+            glEnableVertexAttribArray(attribute);
+            set_attribute_divisor(attribute);
+        }
+
+        glBindVertexArray(bound_array);
+    }
+
+    glGenBuffers(1, &projection_buffer);
+    glBindBuffer(GL_UNIFORM_BUFFER, projection_buffer);
+    // The std140 block is the matrix followed by the offset, padded to a whole vec4.
+    const float projection[20] = {};
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(projection), projection, GL_DYNAMIC_DRAW);
+    glBindBufferBase(GL_UNIFORM_BUFFER, 0, projection_buffer);
+    glGenBuffers(1, &stream_buffer);
+    vertex_arrays[stream_buffer] = create_vertex_array(stream_buffer);
+    glEnable(GL_BLEND);
+    apply_blend_mode(BLEND_ALPHA);
+    glActiveTexture(GL_TEXTURE0);
+    current_program = PROGRAM_SHAPE;
+    glUseProgram(programs[current_program]);
+    return true;
+}
+
+void GLDevice::release() {
+    for(int i = 0; i < PROGRAM_MAX; i++) {
+        if(programs[i] != 0)
+            glDeleteProgram(programs[i]);
+        
+        if(instanced_programs[i] != 0)
+            glDeleteProgram(instanced_programs[i]);
+        
+        programs[i] = 0;
+        instanced_programs[i] = 0;
+    }
+
+    if(instance_array != 0)
+        glDeleteVertexArrays(1, &instance_array);
+    
+    if(instance_buffer != 0)
+        glDeleteBuffers(1, &instance_buffer);
+    
+    instance_array = 0;
+    instance_buffer = 0;
+
+    for(auto & pair : vertex_arrays)
+        glDeleteVertexArrays(1, &pair.second);
+    
+    vertex_arrays.clear();
+    if(stream_buffer != 0)
+        glDeleteBuffers(1, &stream_buffer);
+    
+    if(projection_buffer != 0)
+        glDeleteBuffers(1, &projection_buffer);
+    
+    stream_buffer = 0;
+    projection_buffer = 0;
+}
+
+GLuint GLDevice::create_vertex_array(GLuint buffer) {
+    GLuint array;
+    glGenVertexArrays(1, &array);
+    glBindVertexArray(array);
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glEnableVertexAttribArray(ATTRIBUTE_POSITION);
+    glEnableVertexAttribArray(ATTRIBUTE_UV);
+    glEnableVertexAttribArray(ATTRIBUTE_COLOR);
+    glVertexAttribPointer(ATTRIBUTE_POSITION, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (const void *)offsetof(Vertex, x));
+    glVertexAttribPointer(ATTRIBUTE_UV, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (const void *)offsetof(Vertex, u));
+    glVertexAttribPointer(ATTRIBUTE_COLOR, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), (const void *)offsetof(Vertex, r));
+    glBindVertexArray(bound_array);
+    return array;
+}
+
+void GLDevice::bind_vertex_array(GLuint buffer) {
+    GLuint array = vertex_arrays[buffer];
+    if(array == bound_array)
+        return;
+    
+    glBindVertexArray(array);
+    bound_array = array;
+}
+
+void GLDevice::use_program(ShaderProgram program, bool instanced) {
+    if(program == current_program && instanced == current_instanced)
+        return;
+    
+    glUseProgram(instanced ? instanced_programs[program] : programs[program]);
+    current_program = program;
+    current_instanced = instanced;
+}
+
+ShaderProgram GLDevice::get_texture_program() const {
+    if(bound_texture == 0)
+        return PROGRAM_SHAPE;
+    
+    auto found = texture_programs.find(bound_texture);
+    return found != texture_programs.end() ? found->second : PROGRAM_SPRITE;
+}
+
+void GLDevice::start_frame(int width, int height) {
+    glBindTexture(GL_TEXTURE_2D, 0);
+    current_program = PROGRAM_SHAPE;
+    current_instanced = false;
+    glUseProgram(programs[current_program]);
+    clear(0, 0, 0, 0);
+}
+
+void GLDevice::end_frame() {
+    window->swap();
+}
+
+void GLDevice::set_viewport(int width, int height) {
+    glViewport(0, 0, width, height);
+}
+
+void GLDevice::set_projection(const float matrix[16]) {
+    glBindBuffer(GL_UNIFORM_BUFFER, projection_buffer);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, 16 * sizeof(float), matrix);
+}
+
+void GLDevice::bind_framebuffer(GLuint framebuffer) {
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+}
+
+void GLDevice::clear(float r, float g, float b, float a) {
+    glClearColor(r, g, b, a);
+    glClear(GL_COLOR_BUFFER_BIT);
+}
+
+void GLDevice::bind_texture(GLuint texture) {
+    glBindTexture(GL_TEXTURE_2D, texture);
+}
+
+void GLDevice::apply_blend_mode(BlendMode blend) {
+    switch(blend) {
+    case BLEND_ALPHA:
+        glEnable(GL_BLEND);
+        glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+        break;
+    case BLEND_ADD:
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE);
+        break;
+    case BLEND_MULTIPLY:
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA);
+        break;
+    case BLEND_PREMULTIPLIED:
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+        break;
+    default:
+        glDisable(GL_BLEND);
+        break;
+    }
+}
+
+void GLDevice::apply_offset(float x, float y) {
+    const float offset[2] = { x, y };
+    glBindBuffer(GL_UNIFORM_BUFFER, projection_buffer);
+    glBufferSubData(GL_UNIFORM_BUFFER, 16 * sizeof(float), sizeof(offset), offset);
+}
+
+void GLDevice::write_vertices(const Vertex * vertices, size_t count) {
+    GLsizeiptr size = count * sizeof(Vertex);
+    if(size == 0)
+        return;
+    
+    while(capacity < size)
+        capacity = capacity ? capacity * 2 : 65536;
+    
+    // Orphaning the old storage lets the driver keep drawing from it while we fill the new one.
+    glBindBuffer(GL_ARRAY_BUFFER, stream_buffer);
+    glBufferData(GL_ARRAY_BUFFER, capacity, nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, size, vertices);
+}
+
+void GLDevice::draw_arrays(GLenum mode, GLuint buffer, GLint first, GLsizei count) {
+    use_program(get_texture_program(), false);
+    bind_vertex_array(buffer ? buffer : stream_buffer);
+    glDrawArrays(mode, first, count);
+}
+
+void GLDevice::write_instances(const Instance * instances, size_t count) {
+    GLsizeiptr size = count * sizeof(Instance);
+    if(size == 0)
+        return;
+    
+    while(instance_capacity < size)
+        instance_capacity = instance_capacity ? instance_capacity * 2 : 65536;
+    
+    glBindBuffer(GL_ARRAY_BUFFER, instance_buffer);
+    glBufferData(GL_ARRAY_BUFFER, instance_capacity, nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, size, instances);
+}
+
+void GLDevice::draw_instances(GLint first, GLsizei count) {
+    use_program(get_texture_program(), true);
+    if(bound_array != instance_array) {
+        glBindVertexArray(instance_array);
+        bound_array = instance_array;
+    }
+
+    // Core 3.2 has no base instance, so the attribute pointers start at the batch instead.
+    size_t base = first * sizeof(Instance);
+    glBindBuffer(GL_ARRAY_BUFFER, instance_buffer);
+    glVertexAttribPointer(ATTRIBUTE_CENTER, 2, GL_FLOAT, GL_FALSE, sizeof(Instance), (const void *)(base + offsetof(Instance, x)));
+    glVertexAttribPointer(ATTRIBUTE_AXIS_U, 2, GL_FLOAT, GL_FALSE, sizeof(Instance), (const void *)(base + offsetof(Instance, ux)));
+    glVertexAttribPointer(ATTRIBUTE_AXIS_V, 2, GL_FLOAT, GL_FALSE, sizeof(Instance), (const void *)(base + offsetof(Instance, vx)));
+    glVertexAttribPointer(ATTRIBUTE_UV_RECT, 4, GL_FLOAT, GL_FALSE, sizeof(Instance), (const void *)(base + offsetof(Instance, u0)));
+    glVertexAttribPointer(ATTRIBUTE_COLOR, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Instance), (const void *)(base + offsetof(Instance, r)));
+    glDrawArraysInstanced(GL_TRIANGLES, 0, 6, count);
+}
+
+GLuint GLDevice::create_texture(int width, int height, GLenum format, GLenum type, const void * pixels, int row_length) {
+    GLuint texture;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, row_length);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, format, type, pixels);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glBindTexture(GL_TEXTURE_2D, bound_texture);
+    return texture;
+}
+
+void GLDevice::update_texture(GLuint texture, int x, int y, int width, int height, GLenum format, GLenum type, const void * pixels, int row_length) {
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, row_length);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, format, type, pixels);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glBindTexture(GL_TEXTURE_2D, bound_texture);
+}
+
+void GLDevice::delete_texture(GLuint texture) {
+    if(texture == bound_texture)
+        bound_texture = 0;
+    
+    texture_programs.erase(texture);
+    glDeleteTextures(1, &texture);
+}
+
+void GLDevice::set_texture_program(GLuint texture, ShaderProgram program) {
+    texture_programs[texture] = program;
+}
+
+GLuint GLDevice::create_buffer(const Vertex * vertices, size_t count) {
+    GLuint buffer;
+    glGenBuffers(1, &buffer);
+    update_buffer(buffer, vertices, count);
+    vertex_arrays[buffer] = create_vertex_array(buffer);
+    return buffer;
+}
+
+void GLDevice::update_buffer(GLuint buffer, const Vertex * vertices, size_t count) {
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glBufferData(GL_ARRAY_BUFFER, count * sizeof(Vertex), vertices, GL_STATIC_DRAW);
+}
+
+void GLDevice::delete_buffer(GLuint buffer) {
+    auto found = vertex_arrays.find(buffer);
+    if(found != vertex_arrays.end()) {
+        if(found->second == bound_array) {
+            glBindVertexArray(0);
+            bound_array = 0;
+        }
+
+        glDeleteVertexArrays(1, &found->second);
+        vertex_arrays.erase(found);
+    }
+
+    glDeleteBuffers(1, &buffer);
+}
+
+GLuint GLDevice::create_framebuffer(GLuint texture) {
+    GLint previous;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previous);
+    GLuint framebuffer;
+    glGenFramebuffers(1, &framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    glBindFramebuffer(GL_FRAMEBUFFER, previous);
+    if(status != GL_FRAMEBUFFER_COMPLETE) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to create render target! (status 0x%x)", status);
+        glDeleteFramebuffers(1, &framebuffer);
+        return 0;
+    }
+
+    return framebuffer;
+}
+
+void GLDevice::delete_framebuffer(GLuint framebuffer) {
+    glDeleteFramebuffers(1, &framebuffer);
+}
\ No newline at end of file
@@ -0,0 +1,131 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#include "graphics/gpu_profiler.h"
+#include "graphics/render_device.h"
+#include <SDL2/SDL.h>
+
+GpuProfiler::GpuProfiler(RenderDevice * device) {
+    supported = device->has_context() && GLEW_ARB_timer_query;
+    if(supported) {
+        for(Frame & frame : frames)
+            glGenQueries(1, &frame.query);
+    }
+}
+
+GpuProfiler::~GpuProfiler() {
+    if(!supported)
+        return;
+    
+    for(Frame & frame : frames) {
+        glDeleteQueries(1, &frame.query);
+        if(!frame.timestamps.empty())
+            glDeleteQueries(frame.timestamps.size(), frame.timestamps.data());
+    }
+}
+
+GLuint GpuProfiler::next_timestamp(Frame & frame) {
+    if(frame.used == frame.timestamps.size()) {
+        GLuint query;
+        glGenQueries(1, &query);
+        frame.timestamps.push_back(query);
+    }
+
+    return frame.timestamps[frame.used++];
+}
+
+void GpuProfiler::collect(Frame & frame) {
+    if(!frame.pending)
+        return;
+    
+    frame.pending = false;
+    GLint available = 0;
+    glGetQueryObjectiv(frame.query, GL_QUERY_RESULT_AVAILABLE, &available);
+    if(available && frame.used > 0)
+        glGetQueryObjectiv(frame.timestamps[frame.used - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+    
+    if(!available)
+        return;
+    
+    GLuint64 elapsed;
+    glGetQueryObjectui64v(frame.query, GL_QUERY_RESULT, &elapsed);
+    gpu_time = elapsed / 1000000.0;
+    pass_times.clear();
+    for(const Pass & pass : frame.passes) {
+        GLuint64 start, end;
+        glGetQueryObjectui64v(frame.timestamps[pass.start], GL_QUERY_RESULT, &start);
+        glGetQueryObjectui64v(frame.timestamps[pass.end], GL_QUERY_RESULT, &end);
+        pass_times[pass.name] += (end - start) / 1000000.0;
+    }
+}
+
+void GpuProfiler::begin_frame() {
+    cpu_start = SDL_GetPerformanceCounter();
+    if(!supported)
+        return;
+    
+    current = (current + 1) % PROFILER_FRAMES;
+    Frame & frame = frames[current];
+    collect(frame);
+    frame.used = 0;
+    frame.passes.clear();
+    open_passes.clear();
+    glBeginQuery(GL_TIME_ELAPSED, frame.query);
+    running = true;
+}
+
+void GpuProfiler::end_frame() {
+    cpu_time = (SDL_GetPerformanceCounter() - cpu_start) * 1000.0 / SDL_GetPerformanceFrequency();
+    if(!running)
+        return;
+    
+    while(!open_passes.empty())
+        end_pass();
+    
+    glEndQuery(GL_TIME_ELAPSED);
+    frames[current].pending = true;
+    running = false;
+}
+
+void GpuProfiler::begin_pass(const std::string & name) {
+    if(!running)
+        return;
+    
+    // Time-elapsed queries cannot nest inside the frame query, so passes use timestamp pairs.
+    Frame & frame = frames[current];
+    size_t start = frame.used;
+    glQueryCounter(next_timestamp(frame), GL_TIMESTAMP);
+    open_passes.push_back(frame.passes.size());
+    frame.passes.push_back({ name, start, start });
+}
+
+void GpuProfiler::end_pass() {
+    if(!running || open_passes.empty())
+        return;
+    
+    Frame & frame = frames[current];
+    Pass & pass = frame.passes[open_passes.back()];
+    open_passes.pop_back();
+    pass.end = frame.used;
+    glQueryCounter(next_timestamp(frame), GL_TIMESTAMP);
+}
\ No newline at end of file
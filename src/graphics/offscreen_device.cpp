@@ -0,0 +1,117 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#include "graphics/offscreen_device.h"
+#include <EGL/eglext.h>
+#include <SDL2/SDL.h>
+
+OffscreenDevice::~OffscreenDevice() {
+    if(context == EGL_NO_CONTEXT)
+        return;
+    
+    if(framebuffer != 0) {
+        glDeleteFramebuffers(1, &framebuffer);
+        glDeleteRenderbuffers(1, &renderbuffer);
+    }
+
+    release();
+    eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglDestroyContext(display, context);
+    eglTerminate(display);
+}
+
+bool OffscreenDevice::initialize() {
+    PFNEGLGETPLATFORMDISPLAYEXTPROC get_platform_display = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+    if(get_platform_display != nullptr)
+        display = get_platform_display(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+    
+    if(display == EGL_NO_DISPLAY || !eglInitialize(display, nullptr, nullptr)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Could not open a surfaceless EGL display! (0x%x)", eglGetError());
+        return false;
+    }
+
+    const EGLint attributes[] = { EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_NONE };
+    EGLConfig config;
+    EGLint count;
+    if(!eglBindAPI(EGL_OPENGL_API) || !eglChooseConfig(display, attributes, &config, 1, &count) || count == 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Could not find an EGL config for OpenGL! (0x%x)", eglGetError());
+        eglTerminate(display);
+        return false;
+    }
+
+    const EGLint context_attributes[] = {
+        EGL_CONTEXT_MAJOR_VERSION_KHR, 3,
+        EGL_CONTEXT_MINOR_VERSION_KHR, 2,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR,
+        EGL_NONE
+    };
+
+    context = eglCreateContext(display, config, EGL_NO_CONTEXT, context_attributes);
+    if(context == EGL_NO_CONTEXT)
+        context = eglCreateContext(display, config, EGL_NO_CONTEXT, nullptr);
+    
+    if(context == EGL_NO_CONTEXT || !eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Could not create an EGL context! (0x%x)", eglGetError());
+        if(context != EGL_NO_CONTEXT)
+            eglDestroyContext(display, context);
+        
+        context = EGL_NO_CONTEXT;
+        eglTerminate(display);
+        return false;
+    }
+
+    // GLEW still loads the core entry points when it finds no GLX display.
+    glewExperimental = GL_TRUE;
+    GLenum error = glewInit();
+    if(error != GLEW_OK && error != GLEW_ERROR_NO_GLX_DISPLAY) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Could not initialize GLEW! (%s)", glewGetErrorString(error));
+        return false;
+    }
+
+    glGenFramebuffers(1, &framebuffer);
+    glGenRenderbuffers(1, &renderbuffer);
+    return create_pipeline();
+}
+
+void OffscreenDevice::start_frame(int width, int height) {
+    if(width != this->width || height != this->height) {
+        this->width = width;
+        this->height = height;
+        glBindRenderbuffer(GL_RENDERBUFFER, renderbuffer);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, renderbuffer);
+    }
+
+    bind_framebuffer(0);
+    GLDevice::start_frame(width, height);
+}
+
+void OffscreenDevice::end_frame() {
+    glFinish();
+}
+
+void OffscreenDevice::bind_framebuffer(GLuint framebuffer) {
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer ? framebuffer : this->framebuffer);
+}
\ No newline at end of file
@@ -0,0 +1,208 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#include "graphics/particle_emitter.h"
+#include "graphics/renderer.h"
+#include "graphics/texture.h"
+#include <math.h>
+#ifdef __SSE__
+#include <xmmintrin.h>
+#endif
+
+ParticleEmitter::ParticleEmitter(size_t capacity) : capacity(capacity) {
+    x.resize(capacity);
+    y.resize(capacity);
+    vx.resize(capacity);
+    vy.resize(capacity);
+    age.resize(capacity);
+    lifetime.resize(capacity);
+}
+
+float ParticleEmitter::random(float min, float max) {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return min + (max - min) * (seed >> 8) * (1.0f / 16777216.0f);
+}
+
+void ParticleEmitter::set_lifetime(float min, float max) {
+    min_lifetime = min > 0.001f ? min : 0.001f;
+    max_lifetime = max > min_lifetime ? max : min_lifetime;
+}
+
+void ParticleEmitter::set_speed(float min, float max) {
+    min_speed = min;
+    max_speed = max;
+}
+
+void ParticleEmitter::set_direction(float direction, float spread) {
+    this->direction = direction;
+    this->spread = spread;
+}
+
+void ParticleEmitter::set_sizes(float start, float end) {
+    start_size = start;
+    end_size = end;
+}
+
+void ParticleEmitter::set_start_color(float r, float g, float b, float a) {
+    start_color[0] = r;
+    start_color[1] = g;
+    start_color[2] = b;
+    start_color[3] = a;
+}
+
+void ParticleEmitter::set_end_color(float r, float g, float b, float a) {
+    end_color[0] = r;
+    end_color[1] = g;
+    end_color[2] = b;
+    end_color[3] = a;
+}
+
+void ParticleEmitter::emit(size_t amount) {
+    if(amount > capacity - count)
+        amount = capacity - count;
+    
+    for(size_t i = count; i < count + amount; i++) {
+        float angle = direction + random(-spread / 2, spread / 2);
+        float speed = random(min_speed, max_speed);
+        x[i] = position.x;
+        y[i] = position.y;
+        vx[i] = cosf(angle) * speed;
+        vy[i] = sinf(angle) * speed;
+        age[i] = 0;
+        lifetime[i] = random(min_lifetime, max_lifetime);
+    }
+
+    count += amount;
+}
+
+void ParticleEmitter::integrate(float dt) {
+    float gx = gravity.x * dt;
+    float gy = gravity.y * dt;
+    float * __restrict px = x.data();
+    float * __restrict py = y.data();
+    float * __restrict pvx = vx.data();
+    float * __restrict pvy = vy.data();
+    float * __restrict page = age.data();
+    size_t i = 0;
+#ifdef __SSE__
+    __m128 vdt = _mm_set1_ps(dt);
+    __m128 vgx = _mm_set1_ps(gx);
+    __m128 vgy = _mm_set1_ps(gy);
+    for(; i + 4 <= count; i += 4) {
+        __m128 velocity_x = _mm_add_ps(_mm_loadu_ps(pvx + i), vgx);
+        __m128 velocity_y = _mm_add_ps(_mm_loadu_ps(pvy + i), vgy);
+        _mm_storeu_ps(pvx + i, velocity_x);
+        _mm_storeu_ps(pvy + i, velocity_y);
+        _mm_storeu_ps(px + i, _mm_add_ps(_mm_loadu_ps(px + i), _mm_mul_ps(velocity_x, vdt)));
+        _mm_storeu_ps(py + i, _mm_add_ps(_mm_loadu_ps(py + i), _mm_mul_ps(velocity_y, vdt)));
+        _mm_storeu_ps(page + i, _mm_add_ps(_mm_loadu_ps(page + i), vdt));
+    }
+#endif
+    for(; i < count; i++) {
+        pvx[i] += gx;
+        pvy[i] += gy;
+        px[i] += pvx[i] * dt;
+        py[i] += pvy[i] * dt;
+        page[i] += dt;
+    }
+}
+
+void ParticleEmitter::remove_dead() {
+    size_t i = 0;
+    while(i < count) {
+        if(age[i] < lifetime[i]) {
+            i++;
+            continue;
+        }
+
+        count--;
+        x[i] = x[count];
+        y[i] = y[count];
+        vx[i] = vx[count];
+        vy[i] = vy[count];
+        age[i] = age[count];
+        lifetime[i] = lifetime[count];
+    }
+}
+
+void ParticleEmitter::update(double dt) {
+    integrate(dt);
+    remove_dead();
+    accumulator += rate * dt;
+    if(accumulator >= 1) {
+        size_t amount = accumulator;
+        accumulator -= amount;
+        emit(amount);
+    }
+}
+
+void ParticleEmitter::draw(Renderer * renderer) const {
+    if(count == 0)
+        return;
+    
+    GLuint handle = 0;
+    Rect2 uv(0, 0, 1, 1);
+    if(texture != nullptr) {
+        if(!texture->is_ready())
+            return;
+        
+        handle = texture->get_texture();
+        uv = texture->get_uv();
+    }
+
+    float min_x = x[0];
+    float min_y = y[0];
+    float max_x = x[0];
+    float max_y = y[0];
+    for(size_t i = 1; i < count; i++) {
+        min_x = fminf(min_x, x[i]);
+        min_y = fminf(min_y, y[i]);
+        max_x = fmaxf(max_x, x[i]);
+        max_y = fmaxf(max_y, y[i]);
+    }
+
+    float extent = fmaxf(fabsf(start_size), fabsf(end_size)) / 2;
+    if(!renderer->is_visible(Rect2(min_x - extent, min_y - extent, max_x - min_x + extent * 2, max_y - min_y + extent * 2)))
+        return;
+    
+    float u0 = uv.position.x;
+    float v0 = uv.position.y;
+    float u1 = uv.position.x + uv.size.x;
+    float v1 = uv.position.y + uv.size.y;
+    float color_delta[4];
+    for(int c = 0; c < 4; c++)
+        color_delta[c] = end_color[c] - start_color[c];
+    
+    Instance * instance = renderer->push_instances(handle, count);
+    for(size_t i = 0; i < count; i++) {
+        float t = age[i] / lifetime[i];
+        float half = (start_size + (end_size - start_size) * t) / 2;
+        uint8_t r = color_channel(start_color[0] + color_delta[0] * t);
+        uint8_t g = color_channel(start_color[1] + color_delta[1] * t);
+        uint8_t b = color_channel(start_color[2] + color_delta[2] * t);
+        uint8_t a = color_channel(start_color[3] + color_delta[3] * t);
+        *instance++ = { x[i], y[i], half, 0, 0, half, u0, v0, u1, v1, r, g, b, a };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#include "graphics/rect_packer.h"
+#include <limits.h>
+
+RectPacker::RectPacker(int width, int height) : width(width), height(height) {
+    clear();
+}
+
+int RectPacker::fit(size_t index, int w, int h) const {
+    int x = skyline[index].x;
+    if(x + w > width)
+        return -1;
+    
+    int y = skyline[index].y;
+    int remaining = w;
+    while(remaining > 0) {
+        if(index >= skyline.size())
+            return -1;
+        
+        if(skyline[index].y > y)
+            y = skyline[index].y;
+        
+        if(y + h > height)
+            return -1;
+        
+        remaining -= skyline[index].width;
+        index++;
+    }
+
+    return y;
+}
+
+bool RectPacker::pack(int w, int h, SDL_Rect & rect) {
+    if(w <= 0 || h <= 0)
+        return false;
+    
+    int best_bottom = INT_MAX;
+    int best_width = INT_MAX;
+    int best_y = 0;
+    size_t best_index = skyline.size();
+    for(size_t i = 0; i < skyline.size(); i++) {
+        int y = fit(i, w, h);
+        if(y < 0)
+            continue;
+        
+        if(y + h < best_bottom || (y + h == best_bottom && skyline[i].width < best_width)) {
+            best_bottom = y + h;
+            best_width = skyline[i].width;
+            best_y = y;
+            best_index = i;
+        }
+    }
+
+    if(best_index == skyline.size())
+        return false;
+    
+    rect = { skyline[best_index].x, best_y, w, h };
+    skyline.insert(skyline.begin() + best_index, { rect.x, best_y + h, w });
+    for(size_t i = best_index + 1; i < skyline.size(); i++) {
+        const Node & previous = skyline[i - 1];
+        if(skyline[i].x >= previous.x + previous.width)
+            break;
+        
+        int shrink = previous.x + previous.width - skyline[i].x;
+        skyline[i].x += shrink;
+        skyline[i].width -= shrink;
+        if(skyline[i].width > 0)
+            break;
+        
+        skyline.erase(skyline.begin() + i);
+        i--;
+    }
+
+    for(size_t i = 0; i + 1 < skyline.size(); i++) {
+        if(skyline[i].y == skyline[i + 1].y) {
+            skyline[i].width += skyline[i + 1].width;
+            skyline.erase(skyline.begin() + i + 1);
+            i--;
+        }
+    }
+
+    return true;
+}
+
+void RectPacker::clear() {
+    skyline.clear();
+    skyline.push_back({ 0, 0, width });
+}
\ No newline at end of file
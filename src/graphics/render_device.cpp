@@ -0,0 +1,103 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#include "graphics/render_device.h"
+#include "graphics/gl_device.h"
+#include "graphics/null_device.h"
+#include "graphics/offscreen_device.h"
+
+void RenderDevice::begin_frame(int width, int height) {
+    last_stats = stats;
+    stats = RenderStats();
+    bound_texture = 0;
+    start_frame(width, height);
+}
+
+void RenderDevice::set_blend_mode(BlendMode blend) {
+    if(blend == this->blend)
+        return;
+    
+    this->blend = blend;
+    stats.state_changes++;
+    apply_blend_mode(blend);
+}
+
+void RenderDevice::set_offset(float x, float y) {
+    if(x == offset_x && y == offset_y)
+        return;
+    
+    offset_x = x;
+    offset_y = y;
+    stats.state_changes++;
+    apply_offset(x, y);
+}
+
+void RenderDevice::upload_vertices(const Vertex * vertices, size_t count) {
+    stats.uploaded_bytes += count * sizeof(Vertex);
+    write_vertices(vertices, count);
+}
+
+void RenderDevice::use_texture(GLuint texture) {
+    if(texture == bound_texture)
+        return;
+    
+    bound_texture = texture;
+    stats.texture_binds++;
+    bind_texture(texture);
+}
+
+void RenderDevice::draw(GLenum mode, GLuint texture, GLuint buffer, GLint first, GLsizei count) {
+    use_texture(texture);
+    stats.draw_calls++;
+    stats.vertices += count;
+    draw_arrays(mode, buffer, first, count);
+}
+
+void RenderDevice::upload_instances(const Instance * instances, size_t count) {
+    stats.uploaded_bytes += count * sizeof(Instance);
+    write_instances(instances, count);
+}
+
+void RenderDevice::draw_instanced(GLuint texture, GLint first, GLsizei count) {
+    use_texture(texture);
+    stats.draw_calls++;
+    stats.vertices += count * 6;
+    draw_instances(first, count);
+}
+
+RenderDevice * create_render_device(const std::string & name, Window * window) {
+    RenderDevice * device;
+    if(name == "null")
+        device = new NullDevice();
+    else if(name == "offscreen")
+        device = new OffscreenDevice(window);
+    else
+        device = new GLDevice(window);
+    
+    if(!device->initialize()) {
+        delete device;
+        return nullptr;
+    }
+
+    return device;
+}
\ No newline at end of file
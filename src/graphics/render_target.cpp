@@ -0,0 +1,71 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#include "graphics/render_target.h"
+#include "graphics/renderer.h"
+
+RenderTarget::RenderTarget(Renderer * renderer, int width, int height) : renderer(renderer), width(width), height(height) {
+    RenderDevice * device = renderer->get_device();
+    texture = device->create_texture(width, height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    framebuffer = device->create_framebuffer(texture);
+}
+
+RenderTarget::~RenderTarget() {
+    if(framebuffer != 0)
+        renderer->get_device()->delete_framebuffer(framebuffer);
+    
+    renderer->release_texture(texture);
+}
+
+bool RenderTarget::begin() {
+    if(framebuffer == 0)
+        return false;
+    
+    renderer->push_target(framebuffer, width, height);
+    active = true;
+    return true;
+}
+
+bool RenderTarget::end() {
+    if(!active || !renderer->pop_target(framebuffer))
+        return false;
+    
+    active = false;
+    valid = true;
+    return true;
+}
+
+bool RenderTarget::is_active() const {
+    return active && renderer->has_target(framebuffer);
+}
+
+void RenderTarget::draw(const Rect2 & rectangle) {
+    if(!valid)
+        return;
+    
+    // Framebuffer rows are bottom-up and blending into a cleared target leaves premultiplied color.
+    BlendMode blend = renderer->get_blend_mode();
+    renderer->set_blend_mode(BLEND_PREMULTIPLIED);
+    renderer->draw_texture(texture, rectangle, Rect2(0, 1, 1, -1));
+    renderer->set_blend_mode(blend);
+}
\ No newline at end of file
@@ -0,0 +1,551 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#include "graphics/renderer.h"
+#include <math.h>
+
+#define CIRCLE_MAX_ERROR 0.25
+#define CIRCLE_MIN_SEGMENTS 8
+#define CIRCLE_MAX_SEGMENTS 512
+
+static Vertex make_vertex(double x, double y, double u = 0, double v = 0) {
+    return { (float)x, (float)y, (float)u, (float)v, 255, 255, 255, 255 };
+}
+
+Renderer::Renderer(RenderDevice * device) : device(device), atlas(device), profiler(device), fonts(this) {
+    vertices.reserve(4096);
+}
+
+Renderer::~Renderer() {
+    fonts.clear();
+    for(GLuint buffer : released_buffers)
+        device->delete_buffer(buffer);
+    
+    for(GLuint texture : released_textures)
+        device->delete_texture(texture);
+}
+
+static bool is_mergeable(GLenum mode) {
+    return mode == GL_TRIANGLES || mode == GL_LINES || mode == GL_POINTS;
+}
+
+uint64_t Renderer::make_key(GLuint texture) const {
+    uint64_t key = (uint64_t)layer << 56;
+    if(sorted_layers[layer])
+        key |= (uint64_t)blend << 52 | (uint64_t)(texture & 0xFFFFF) << 32 | (uint64_t)depth << 16;
+    
+    return key;
+}
+
+void Renderer::add_batch(const Batch & batch) {
+    if(!batches.empty() && batch.key < batches.back().key)
+        needs_sort = true;
+    
+    batches.push_back(batch);
+}
+
+Vertex * Renderer::push_vertices(GLenum mode, GLuint texture, GLsizei count) {
+    GLint first = vertices.size();
+    uint64_t key = make_key(texture);
+    if(is_mergeable(mode) && !batches.empty()) {
+        Batch & last = batches.back();
+        if(last.buffer == 0 && !last.instanced && last.key == key && last.mode == mode && last.texture == texture && last.blend == blend)
+            last.count += count;
+        else
+            add_batch({ key, mode, texture, 0, blend, first, count });
+    } else {
+        add_batch({ key, mode, texture, 0, blend, first, count });
+    }
+
+    vertices.resize(first + count);
+    return vertices.data() + first;
+}
+
+Instance * Renderer::push_instances(GLuint texture, GLsizei count) {
+    GLint first = instances.size();
+    uint64_t key = make_key(texture);
+    Batch * last = batches.empty() ? nullptr : &batches.back();
+    if(last != nullptr && last->instanced && last->key == key && last->texture == texture && last->blend == blend)
+        last->count += count;
+    else
+        add_batch({ key, GL_TRIANGLES, texture, 0, blend, first, count, 0, 0, true });
+    
+    instances.resize(first + count);
+    return instances.data() + first;
+}
+
+void Renderer::trim_instances(GLsizei count) {
+    if(count <= 0)
+        return;
+    
+    instances.resize(instances.size() - count);
+    batches.back().count -= count;
+    if(batches.back().count == 0)
+        batches.pop_back();
+}
+
+void Renderer::fill_rectangle(const Rect2 & rectangle) {
+    if(!is_visible(rectangle))
+        return;
+    
+    double x0 = rectangle.position.x;
+    double y0 = rectangle.position.y;
+    double x1 = rectangle.position.x + rectangle.size.x;
+    double y1 = rectangle.position.y + rectangle.size.y;
+    Vertex * v = push_vertices(GL_TRIANGLES, 0, 6);
+    v[0] = make_vertex(x0, y0);
+    v[1] = make_vertex(x1, y0);
+    v[2] = make_vertex(x1, y1);
+    v[3] = make_vertex(x0, y0);
+    v[4] = make_vertex(x1, y1);
+    v[5] = make_vertex(x0, y1);
+}
+
+void Renderer::draw_rectangle(const Rect2 & rectangle) {
+    if(!is_visible(rectangle))
+        return;
+    
+    double x0 = rectangle.position.x;
+    double y0 = rectangle.position.y;
+    double x1 = rectangle.position.x + rectangle.size.x;
+    double y1 = rectangle.position.y + rectangle.size.y;
+    Vertex * v = push_vertices(GL_LINES, 0, 8);
+    v[0] = make_vertex(x0, y0);
+    v[1] = make_vertex(x1, y0);
+    v[2] = make_vertex(x1, y0);
+    v[3] = make_vertex(x1, y1);
+    v[4] = make_vertex(x1, y1);
+    v[5] = make_vertex(x0, y1);
+    v[6] = make_vertex(x0, y1);
+    v[7] = make_vertex(x0, y0);
+}
+
+static int circle_segments(double radius) {
+    if(radius <= CIRCLE_MAX_ERROR)
+        return CIRCLE_MIN_SEGMENTS;
+    
+    int segments = ceil(M_PI / acos(1 - CIRCLE_MAX_ERROR / radius));
+    segments = (segments + 3) & ~3;
+    if(segments < CIRCLE_MIN_SEGMENTS)
+        return CIRCLE_MIN_SEGMENTS;
+    
+    if(segments > CIRCLE_MAX_SEGMENTS)
+        return CIRCLE_MAX_SEGMENTS;
+    
+    return segments;
+}
+
+const std::vector<float> & Renderer::get_unit_circle(int segments) {
+    std::vector<float> & table = circle_tables[segments];
+    if(table.empty()) {
+        table.resize((segments + 1) * 2);
+        for(int i = 0; i < segments; i++) {
+            double angle = 2 * M_PI * i / segments;
+            table[i * 2] = cos(angle);
+            table[i * 2 + 1] = sin(angle);
+        }
+
+        table[segments * 2] = table[0];
+        table[segments * 2 + 1] = table[1];
+    }
+
+    return table;
+}
+
+void Renderer::fill_circle(const Vector2 & center, double radius) {
+    if(!is_visible(Rect2(center.x - fabs(radius), center.y - fabs(radius), fabs(radius) * 2, fabs(radius) * 2)))
+        return;
+    
+    int segments = circle_segments(fabs(radius) * camera.get_zoom());
+    const float * table = get_unit_circle(segments).data();
+    float cx = center.x;
+    float cy = center.y;
+    float r = radius;
+    Vertex * v = push_vertices(GL_TRIANGLES, 0, segments * 3);
+    for(int i = 0; i < segments; i++) {
+        *v++ = { cx, cy, 0, 0, 255, 255, 255, 255 };
+        *v++ = { cx + table[i * 2] * r, cy + table[i * 2 + 1] * r, 0, 0, 255, 255, 255, 255 };
+        *v++ = { cx + table[i * 2 + 2] * r, cy + table[i * 2 + 3] * r, 0, 0, 255, 255, 255, 255 };
+    }
+}
+
+void Renderer::draw_circle(const Vector2 & center, double radius) {
+    if(!is_visible(Rect2(center.x - fabs(radius), center.y - fabs(radius), fabs(radius) * 2, fabs(radius) * 2)))
+        return;
+    
+    int segments = circle_segments(fabs(radius) * camera.get_zoom());
+    const float * table = get_unit_circle(segments).data();
+    float cx = center.x;
+    float cy = center.y;
+    float r = radius;
+    Vertex * v = push_vertices(GL_LINES, 0, segments * 2);
+    for(int i = 0; i < segments; i++) {
+        *v++ = { cx + table[i * 2] * r, cy + table[i * 2 + 1] * r, 0, 0, 255, 255, 255, 255 };
+        *v++ = { cx + table[i * 2 + 2] * r, cy + table[i * 2 + 3] * r, 0, 0, 255, 255, 255, 255 };
+    }
+}
+
+void Renderer::draw_line(const Vector2 & start, const Vector2 & end) {
+    if(!is_visible(Rect2(start.x, start.y, end.x - start.x, end.y - start.y)))
+        return;
+    
+    Vertex * v = push_vertices(GL_LINES, 0, 2);
+    v[0] = make_vertex(start.x, start.y);
+    v[1] = make_vertex(end.x, end.y);
+}
+
+void Renderer::draw_texture(GLuint texture, const Rect2 & rectangle, const Rect2 & uv) {
+    if(!is_visible(rectangle))
+        return;
+    
+    double x0 = rectangle.position.x;
+    double y0 = rectangle.position.y;
+    double x1 = rectangle.position.x + rectangle.size.x;
+    double y1 = rectangle.position.y + rectangle.size.y;
+    double u0 = uv.position.x;
+    double v0 = uv.position.y;
+    double u1 = uv.position.x + uv.size.x;
+    double v1 = uv.position.y + uv.size.y;
+    Vertex * v = push_vertices(GL_TRIANGLES, texture, 6);
+    v[0] = make_vertex(x0, y0, u0, v0);
+    v[1] = make_vertex(x1, y0, u1, v0);
+    v[2] = make_vertex(x1, y1, u1, v1);
+    v[3] = make_vertex(x0, y0, u0, v0);
+    v[4] = make_vertex(x1, y1, u1, v1);
+    v[5] = make_vertex(x0, y1, u0, v1);
+}
+
+void Renderer::draw_sprites(GLuint texture, const Rect2 & uv, double width, double height, const SpriteInstance * instances, size_t count) {
+    float u0 = uv.position.x;
+    float v0 = uv.position.y;
+    float u1 = uv.position.x + uv.size.x;
+    float v1 = uv.position.y + uv.size.y;
+    float half_width = width / 2;
+    float half_height = height / 2;
+    float bound = sqrtf(half_width * half_width + half_height * half_height);
+    float left = view.position.x;
+    float top = view.position.y;
+    float right = view.position.x + view.size.x;
+    float bottom = view.position.y + view.size.y;
+    size_t culled = 0;
+    Instance * out = push_instances(texture, count);
+    for(size_t i = 0; i < count; i++) {
+        const SpriteInstance & instance = instances[i];
+        float extent = bound * fabsf(instance.scale);
+        if(instance.x + extent < left || instance.x - extent > right || instance.y + extent < top || instance.y - extent > bottom) {
+            culled++;
+            continue;
+        }
+
+        float c = cosf(instance.rotation) * instance.scale;
+        float s = sinf(instance.rotation) * instance.scale;
+        *out++ = { instance.x, instance.y, c * half_width, s * half_width, -s * half_height, c * half_height, u0, v0, u1, v1, color_channel(instance.r), color_channel(instance.g), color_channel(instance.b), color_channel(instance.a) };
+    }
+
+    trim_instances(culled);
+}
+
+void Renderer::fill_rectangles(const RectangleInstance * instances, size_t count) {
+    size_t culled = 0;
+    Instance * out = push_instances(0, count);
+    for(size_t i = 0; i < count; i++) {
+        const RectangleInstance & instance = instances[i];
+        if(!is_visible(Rect2(instance.x, instance.y, instance.width, instance.height))) {
+            culled++;
+            continue;
+        }
+
+        float half_width = instance.width / 2;
+        float half_height = instance.height / 2;
+        *out++ = { instance.x + half_width, instance.y + half_height, half_width, 0, 0, half_height, 0, 0, 0, 0, color_channel(instance.r), color_channel(instance.g), color_channel(instance.b), color_channel(instance.a) };
+    }
+
+    trim_instances(culled);
+}
+
+void Renderer::draw_buffer(GLuint buffer, GLenum mode, GLuint texture, GLsizei count, const Vector2 & offset) {
+    if(buffer != 0 && count > 0)
+        add_batch({ make_key(texture), mode, texture, buffer, blend, 0, count, (float)offset.x, (float)offset.y });
+}
+
+void Renderer::release_texture(GLuint texture) {
+    released_textures.push_back(texture);
+}
+
+void Renderer::release_buffer(GLuint buffer) {
+    released_buffers.push_back(buffer);
+}
+
+static void radix_sort(std::vector<uint64_t> & keys, std::vector<uint32_t> & order) {
+    size_t count = keys.size();
+    std::vector<uint64_t> key_scratch(count);
+    std::vector<uint32_t> order_scratch(count);
+    uint64_t varying = 0;
+    for(size_t i = 1; i < count; i++)
+        varying |= keys[i] ^ keys[0];
+    
+    for(int shift = 0; shift < 64; shift += 8) {
+        if(((varying >> shift) & 0xFF) == 0)
+            continue;
+        
+        size_t offsets[256] = {};
+        for(size_t i = 0; i < count; i++)
+            offsets[(keys[i] >> shift) & 0xFF]++;
+        
+        size_t total = 0;
+        for(size_t & offset : offsets) {
+            size_t bucket = offset;
+            offset = total;
+            total += bucket;
+        }
+
+        for(size_t i = 0; i < count; i++) {
+            size_t index = offsets[(keys[i] >> shift) & 0xFF]++;
+            key_scratch[index] = keys[i];
+            order_scratch[index] = order[i];
+        }
+
+        keys.swap(key_scratch);
+        order.swap(order_scratch);
+    }
+}
+
+void Renderer::sort_batches() {
+    std::vector<uint64_t> keys(batches.size());
+    std::vector<uint32_t> order(batches.size());
+    for(size_t i = 0; i < batches.size(); i++) {
+        keys[i] = batches[i].key;
+        order[i] = i;
+    }
+
+    radix_sort(keys, order);
+    sorted_vertices.clear();
+    sorted_instances.clear();
+    sorted_batches.clear();
+    for(uint32_t index : order) {
+        Batch batch = batches[index];
+        if(batch.instanced) {
+            GLint first = sorted_instances.size();
+            sorted_instances.insert(sorted_instances.end(), instances.begin() + batch.first, instances.begin() + batch.first + batch.count);
+            batch.first = first;
+            if(!sorted_batches.empty()) {
+                Batch & last = sorted_batches.back();
+                if(last.instanced && last.texture == batch.texture && last.blend == batch.blend) {
+                    last.count += batch.count;
+                    continue;
+                }
+            }
+        } else if(batch.buffer == 0) {
+            GLint first = sorted_vertices.size();
+            sorted_vertices.insert(sorted_vertices.end(), vertices.begin() + batch.first, vertices.begin() + batch.first + batch.count);
+            batch.first = first;
+            if(!sorted_batches.empty() && is_mergeable(batch.mode)) {
+                Batch & last = sorted_batches.back();
+                if(last.buffer == 0 && !last.instanced && last.mode == batch.mode && last.texture == batch.texture && last.blend == batch.blend) {
+                    last.count += batch.count;
+                    continue;
+                }
+            }
+        }
+
+        sorted_batches.push_back(batch);
+    }
+
+    vertices.swap(sorted_vertices);
+    instances.swap(sorted_instances);
+    batches.swap(sorted_batches);
+}
+
+void Renderer::set_viewport(int width, int height, const Camera2D & camera) {
+    this->width = width;
+    this->height = height;
+    this->camera = camera;
+    view = camera.get_visible_rect(width, height);
+    float projection[16];
+    camera.get_projection(width, height, projection);
+    device->set_viewport(width, height);
+    device->set_projection(projection);
+}
+
+static Camera2D screen_camera(int width, int height) {
+    return Camera2D(Vector2(width / 2.0, height / 2.0));
+}
+
+void Renderer::begin_frame(int width, int height) {
+    device->begin_frame(width, height);
+    set_viewport(width, height, screen_camera(width, height));
+}
+
+void Renderer::set_camera(const Camera2D & camera) {
+    submit();
+    set_viewport(width, height, camera);
+}
+
+void Renderer::reset_camera() {
+    set_camera(screen_camera(width, height));
+}
+
+bool Renderer::is_visible(const Rect2 & bounds) const {
+    Rect2 normalized = bounds;
+    if(normalized.size.x < 0) {
+        normalized.position.x += normalized.size.x;
+        normalized.size.x = -normalized.size.x;
+    }
+
+    if(normalized.size.y < 0) {
+        normalized.position.y += normalized.size.y;
+        normalized.size.y = -normalized.size.y;
+    }
+
+    return view.intersects(normalized);
+}
+
+void Renderer::push_target(GLuint framebuffer, int width, int height) {
+    submit();
+    targets.push_back({ this->framebuffer, this->width, this->height, camera });
+    this->framebuffer = framebuffer;
+    device->bind_framebuffer(framebuffer);
+    set_viewport(width, height, screen_camera(width, height));
+    device->clear(0, 0, 0, 0);
+}
+
+bool Renderer::pop_target(GLuint framebuffer) {
+    if(targets.empty() || this->framebuffer != framebuffer)
+        return false;
+    
+    submit();
+    Target target = targets.back();
+    targets.pop_back();
+    this->framebuffer = target.framebuffer;
+    device->bind_framebuffer(target.framebuffer);
+    set_viewport(target.width, target.height, target.camera);
+    return true;
+}
+
+bool Renderer::has_target(GLuint framebuffer) const {
+    if(targets.empty())
+        return false;
+    
+    if(this->framebuffer == framebuffer)
+        return true;
+    
+    for(const Target & target : targets) {
+        if(target.framebuffer == framebuffer)
+            return true;
+    }
+
+    return false;
+}
+
+void Renderer::expand_instances() {
+    for(Batch & batch : batches) {
+        if(!batch.instanced)
+            continue;
+        
+        GLint first = vertices.size();
+        vertices.resize(first + batch.count * 6);
+        Vertex * v = vertices.data() + first;
+        for(GLsizei i = 0; i < batch.count; i++) {
+            const Instance * instance = &instances[batch.first + i];
+            float x = instance->x;
+            float y = instance->y;
+            Vertex top_left = { x - instance->ux - instance->vx, y - instance->uy - instance->vy, instance->u0, instance->v0, instance->r, instance->g, instance->b, instance->a };
+            Vertex top_right = { x + instance->ux - instance->vx, y + instance->uy - instance->vy, instance->u1, instance->v0, instance->r, instance->g, instance->b, instance->a };
+            Vertex bottom_right = { x + instance->ux + instance->vx, y + instance->uy + instance->vy, instance->u1, instance->v1, instance->r, instance->g, instance->b, instance->a };
+            Vertex bottom_left = { x - instance->ux + instance->vx, y - instance->uy + instance->vy, instance->u0, instance->v1, instance->r, instance->g, instance->b, instance->a };
+            *v++ = top_left;
+            *v++ = top_right;
+            *v++ = bottom_right;
+            *v++ = top_left;
+            *v++ = bottom_right;
+            *v++ = bottom_left;
+        }
+
+        batch.first = first;
+        batch.count *= 6;
+        batch.instanced = false;
+    }
+
+    instances.clear();
+}
+
+void Renderer::submit() {
+    if(batches.empty())
+        return;
+    
+    if(needs_sort)
+        sort_batches();
+    
+    if(!instances.empty() && !device->supports_instancing())
+        expand_instances();
+    
+    device->upload_vertices(vertices.data(), vertices.size());
+    if(!instances.empty())
+        device->upload_instances(instances.data(), instances.size());
+    
+    for(const Batch & batch : batches) {
+        device->set_blend_mode(batch.blend);
+        device->set_offset(batch.offset_x, batch.offset_y);
+        if(batch.instanced)
+            device->draw_instanced(batch.texture, batch.first, batch.count);
+        else
+            device->draw(batch.mode, batch.texture, batch.buffer, batch.first, batch.count);
+    }
+
+    device->set_blend_mode(BLEND_ALPHA);
+    device->set_offset(0, 0);
+    vertices.clear();
+    instances.clear();
+    batches.clear();
+    needs_sort = false;
+}
+
+void Renderer::begin_pass(const std::string & name) {
+    submit();
+    profiler.begin_pass(name);
+}
+
+void Renderer::end_pass() {
+    submit();
+    profiler.end_pass();
+}
+
+void Renderer::flush() {
+    while(!targets.empty())
+        pop_target(framebuffer);
+    
+    submit();
+    layer = 0;
+    blend = BLEND_ALPHA;
+    depth = 0;
+    atlas.reclaim();
+
+    for(GLuint buffer : released_buffers)
+        device->delete_buffer(buffer);
+    
+    for(GLuint texture : released_textures)
+        device->delete_texture(texture);
+    
+    released_buffers.clear();
+    released_textures.clear();
+}
\ No newline at end of file
@@ -0,0 +1,177 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#include "graphics/shader_program.h"
+#include "graphics/texture_cache.h"
+#include <SDL2/SDL.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+
+static uint64_t hash_program(const char * vertex_source, const char * fragment_source) {
+    std::string key = vertex_source;
+    key += fragment_source;
+    key += (const char *)glGetString(GL_VENDOR);
+    key += (const char *)glGetString(GL_RENDERER);
+    key += (const char *)glGetString(GL_VERSION);
+    return hash_texture_data(key.data(), key.size());
+}
+
+static GLuint compile_shader(const char * name, GLenum type, const char * source) {
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, nullptr);
+    glCompileShader(shader);
+    GLint status;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+    if(status == GL_FALSE) {
+        char log[1024];
+        glGetShaderInfoLog(shader, sizeof(log), nullptr, log);
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to compile the %s %s shader! (%s)", name, type == GL_VERTEX_SHADER ? "vertex" : "fragment", log);
+        glDeleteShader(shader);
+        return 0;
+    }
+
+    return shader;
+}
+
+static bool is_linked(GLuint program) {
+    GLint status;
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+    return status == GL_TRUE;
+}
+
+static GLuint load_cached_program(const char * path, uint64_t hash) {
+    int fd = open(path, O_RDONLY);
+    if(fd == -1)
+        return 0;
+    
+    struct stat info;
+    if(fstat(fd, &info) == -1 || (size_t)info.st_size < sizeof(ShaderCacheHeader)) {
+        close(fd);
+        return 0;
+    }
+
+    size_t size = info.st_size;
+    void * mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(mapping == MAP_FAILED)
+        return 0;
+    
+    const ShaderCacheHeader * header = (const ShaderCacheHeader *)mapping;
+    if(header->magic != SHADER_CACHE_MAGIC || header->version != SHADER_CACHE_VERSION || header->hash != hash || header->size > size - sizeof(ShaderCacheHeader)) {
+        munmap(mapping, size);
+        return 0;
+    }
+
+    GLuint program = glCreateProgram();
+    glProgramBinary(program, header->format, header + 1, header->size);
+    munmap(mapping, size);
+    // Drivers may still reject a binary after an update that kept the version string.
+    if(!is_linked(program)) {
+        glDeleteProgram(program);
+        return 0;
+    }
+
+    return program;
+}
+
+static void save_cached_program(const char * path, uint64_t hash, GLuint program) {
+    GLint size = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &size);
+    if(size <= 0)
+        return;
+    
+    std::vector<Uint8> binary(size);
+    GLenum format;
+    glGetProgramBinary(program, size, &size, &format, binary.data());
+    ShaderCacheHeader header = { SHADER_CACHE_MAGIC, SHADER_CACHE_VERSION, hash, format, (uint32_t)size };
+    mkdir(SHADER_CACHE_DIRECTORY, 0755);
+    std::string temporary = std::string(path) + ".tmp";
+    FILE * file = fopen(temporary.c_str(), "wb");
+    if(file == nullptr) {
+        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "Unable to write shader cache %s!", path);
+        return;
+    }
+
+    bool success = fwrite(&header, sizeof(header), 1, file) == 1;
+    success = success && fwrite(binary.data(), 1, size, file) == (size_t)size;
+    success = fclose(file) == 0 && success;
+    if(!success || rename(temporary.c_str(), path) != 0) {
+        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "Unable to write shader cache %s!", path);
+        unlink(temporary.c_str());
+    }
+}
+
+GLuint load_shader_program(const char * name, const char * vertex_source, const char * fragment_source) {
+    bool cacheable = GLEW_ARB_get_program_binary;
+    uint64_t hash = cacheable ? hash_program(vertex_source, fragment_source) : 0;
+    std::string path = std::string(SHADER_CACHE_DIRECTORY "/") + name + ".bin";
+    GLuint program = cacheable ? load_cached_program(path.c_str(), hash) : 0;
+    if(program != 0)
+        return program;
+    
+    GLuint vertex = compile_shader(name, GL_VERTEX_SHADER, vertex_source);
+    GLuint fragment = compile_shader(name, GL_FRAGMENT_SHADER, fragment_source);
+    if(vertex == 0 || fragment == 0) {
+        glDeleteShader(vertex);
+        glDeleteShader(fragment);
+        return 0;
+    }
+
+    program = glCreateProgram();
+    glAttachShader(program, vertex);
+    glAttachShader(program, fragment);
+    glBindAttribLocation(program, ATTRIBUTE_POSITION, "position");
+    glBindAttribLocation(program, ATTRIBUTE_UV, "uv");
+    glBindAttribLocation(program, ATTRIBUTE_COLOR, "color");
+    glBindAttribLocation(program, ATTRIBUTE_CENTER, "center");
+    glBindAttribLocation(program, ATTRIBUTE_AXIS_U, "axis_u");
+    glBindAttribLocation(program, ATTRIBUTE_AXIS_V, "axis_v");
+    glBindAttribLocation(program, ATTRIBUTE_UV_RECT, "uv_rect");
+    glBindFragDataLocation(program, 0, "fragment");
+    if(cacheable)
+        glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    
+    glLinkProgram(program);
+    glDetachShader(program, vertex);
+    glDetachShader(program, fragment);
+    glDeleteShader(vertex);
+    glDeleteShader(fragment);
+    if(!is_linked(program)) {
+        char log[1024];
+        glGetProgramInfoLog(program, sizeof(log), nullptr, log);
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to link the %s program! (%s)", name, log);
+        glDeleteProgram(program);
+        return 0;
+    }
+
+    if(cacheable)
+        save_cached_program(path.c_str(), hash, program);
+    
+    return program;
+}
\ No newline at end of file
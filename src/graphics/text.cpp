@@ -0,0 +1,88 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#include "graphics/text.h"
+#include "graphics/font.h"
+
+void TextMesh::clear() {
+    runs.clear();
+    vertices.clear();
+    width = 0;
+    height = 0;
+    bounds = Rect2();
+}
+
+void TextMesh::draw(Renderer * renderer, const Vector2 & position) const {
+    if(runs.empty() || !renderer->is_visible(Rect2(bounds.position.x + position.x, bounds.position.y + position.y, bounds.size.x, bounds.size.y)))
+        return;
+    
+    for(const Run & run : runs) {
+        Vertex * v = renderer->push_vertices(GL_TRIANGLES, run.texture, run.count);
+        const Vertex * source = vertices.data() + run.first;
+        for(GLsizei i = 0; i < run.count; i++) {
+            v[i] = source[i];
+            v[i].x += position.x;
+            v[i].y += position.y;
+        }
+    }
+}
+
+Text::Text(Font * font, const char * string) : font(font), string(string) {}
+
+void Text::update() {
+    if(dirty) {
+        font->build_text(string.c_str(), color, mesh);
+        dirty = false;
+    }
+}
+
+void Text::set_font(Font * font) {
+    if(this->font != font) {
+        this->font = font;
+        dirty = true;
+    }
+}
+
+void Text::set_string(const char * string) {
+    if(this->string != string) {
+        this->string = string;
+        dirty = true;
+    }
+}
+
+void Text::set_color(SDL_Color color) {
+    if(this->color.r != color.r || this->color.g != color.g || this->color.b != color.b || this->color.a != color.a) {
+        this->color = color;
+        dirty = true;
+    }
+}
+
+void Text::draw(Renderer * renderer, const Vector2 & position) {
+    update();
+    mesh.draw(renderer, position);
+}
+
+Vector2 Text::get_size() {
+    update();
+    return Vector2(mesh.width, mesh.height);
+}
\ No newline at end of file
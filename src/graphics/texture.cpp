@@ -0,0 +1,174 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#include "graphics/texture.h"
+#include "graphics/renderer.h"
+#include "graphics/texture_cache.h"
+#include <SDL2/SDL_image.h>
+#include <unistd.h>
+
+bool get_upload_format(const SDL_Surface * surface, GLenum & format, GLenum & type) {
+    type = GL_UNSIGNED_BYTE;
+    if(SDL_MUSTLOCK(surface))
+        return false;
+    
+    switch(surface->format->format) {
+    case SDL_PIXELFORMAT_RGBA32:
+        format = GL_RGBA;
+        return surface->pitch % 4 == 0;
+    case SDL_PIXELFORMAT_BGRA32:
+        format = GL_BGRA;
+        return surface->pitch % 4 == 0;
+    case SDL_PIXELFORMAT_RGB24:
+        format = GL_RGB;
+        return surface->pitch % 3 == 0;
+    case SDL_PIXELFORMAT_BGR24:
+        format = GL_BGR;
+        return surface->pitch % 3 == 0;
+    default:
+        return false;
+    }
+}
+
+SDL_Surface * prepare_surface(SDL_Surface * surface) {
+    GLenum format, type;
+    if(surface == nullptr || get_upload_format(surface, format, type))
+        return surface;
+    
+    SDL_Surface * image = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA32, 0);
+    SDL_FreeSurface(surface);
+    return image;
+}
+
+void begin_upload(const SDL_Surface * surface) {
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, surface->pitch / surface->format->BytesPerPixel);
+}
+
+void end_upload() {
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+}
+
+bool read_texture_file(const char * path, std::vector<Uint8> & data) {
+    SDL_RWops * file = SDL_RWFromFile(path, "rb");
+    if(file == nullptr)
+        return false;
+    
+    Sint64 size = SDL_RWsize(file);
+    if(size < 0) {
+        SDL_RWclose(file);
+        return false;
+    }
+
+    data.resize(size);
+    bool success = SDL_RWread(file, data.data(), 1, data.size()) == data.size();
+    SDL_RWclose(file);
+    return success;
+}
+
+static GLuint upload_texture(RenderDevice * device, SDL_Surface * image) {
+    GLenum format, type;
+    get_upload_format(image, format, type);
+    return device->create_texture(image->w, image->h, format, type, image->pixels, image->pitch / image->format->BytesPerPixel);
+}
+
+Texture::Texture(Renderer * renderer) : renderer(renderer) {}
+
+Texture::Texture(Renderer * renderer, const char * path) : renderer(renderer) {
+    std::vector<Uint8> data;
+    if(!read_texture_file(path, data)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Unable to load texture %s! (%s)", path, SDL_GetError());
+        return;
+    }
+
+    bool cacheable = renderer->get_device()->has_context();
+    std::string cache_path = std::string(path) + TEXTURE_CACHE_EXTENSION;
+    bool hashed = cacheable && access(cache_path.c_str(), F_OK) == 0;
+    uint64_t hash = hashed ? hash_texture_data(data.data(), data.size()) : 0;
+    if(hashed && load_cached_image(cache_path, hash))
+        return;
+    
+    SDL_Surface * image = prepare_surface(IMG_Load_RW(SDL_RWFromConstMem(data.data(), data.size()), 1));
+    if(image == nullptr) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Unable to load texture %s! (%s)", path, IMG_GetError());
+        return;
+    }
+
+    if(!cacheable || (image->w <= ATLAS_MAX_SPRITE_SIZE && image->h <= ATLAS_MAX_SPRITE_SIZE))
+        set_image(image);
+    else
+        set_mipmapped_image(image, cache_path, hashed ? hash : hash_texture_data(data.data(), data.size()));
+    
+    SDL_FreeSurface(image);
+}
+
+Texture::~Texture() {
+    if(!ready)
+        renderer->get_loader()->cancel(this);
+    
+    if(texture == 0)
+        return;
+    
+    if(atlased)
+        renderer->get_atlas()->release(texture, uv);
+    else
+        renderer->release_texture(texture);
+}
+
+void Texture::set_mipmapped_image(SDL_Surface * image, const std::string & cache_path, uint64_t hash) {
+    width = image->w;
+    height = image->h;
+    texture = upload_mipmapped_texture(image);
+    save_cached_texture(cache_path.c_str(), hash, texture, width, height);
+    ready = true;
+}
+
+bool Texture::load_cached_image(const std::string & cache_path, uint64_t hash) {
+    texture = load_cached_texture(cache_path.c_str(), hash, width, height);
+    ready = texture != 0;
+    return ready;
+}
+
+void Texture::set_image(SDL_Surface * image) {
+    width = image->w;
+    height = image->h;
+    atlased = renderer->get_atlas()->insert(image, texture, uv);
+    if(!atlased)
+        texture = upload_texture(renderer->get_device(), image);
+    
+    ready = true;
+}
+
+void Texture::draw(const Rect2 & rectangle) const {
+    if(ready)
+        renderer->draw_texture(texture, rectangle, uv);
+}
+
+void Texture::draw(const Rect2 & rectangle, const Rect2 & region) const {
+    if(!ready)
+        return;
+    
+    Rect2 source(uv.position.x + region.position.x / width * uv.size.x, uv.position.y + region.position.y / height * uv.size.y, region.size.x / width * uv.size.x, region.size.y / height * uv.size.y);
+    renderer->draw_texture(texture, rectangle, source);
+}
\ No newline at end of file
@@ -0,0 +1,135 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#include "graphics/texture_atlas.h"
+#include "graphics/render_device.h"
+#include "graphics/texture.h"
+#include <math.h>
+
+TextureAtlas::~TextureAtlas() {
+    for(const Page & page : pages)
+        device->delete_texture(page.texture);
+}
+
+bool TextureAtlas::allocate(Page & page, int w, int h, SDL_Rect & rect) {
+    size_t best = page.free_rects.size();
+    for(size_t i = 0; i < page.free_rects.size(); i++) {
+        const SDL_Rect & candidate = page.free_rects[i];
+        if(candidate.w < w || candidate.h < h)
+            continue;
+        
+        if(best == page.free_rects.size() || candidate.w * candidate.h < page.free_rects[best].w * page.free_rects[best].h)
+            best = i;
+    }
+
+    if(best == page.free_rects.size())
+        return page.packer.pack(w, h, rect);
+    
+    SDL_Rect slot = page.free_rects[best];
+    page.free_rects.erase(page.free_rects.begin() + best);
+    rect = { slot.x, slot.y, w, h };
+    if(slot.w > w)
+        page.free_rects.push_back({ slot.x + w, slot.y, slot.w - w, h });
+    
+    if(slot.h > h)
+        page.free_rects.push_back({ slot.x, slot.y + h, slot.w, slot.h - h });
+    
+    return true;
+}
+
+bool TextureAtlas::insert(SDL_Surface * image, GLuint & texture, Rect2 & uv) {
+    if(image->w > ATLAS_MAX_SPRITE_SIZE || image->h > ATLAS_MAX_SPRITE_SIZE)
+        return false;
+    
+    SDL_Rect rect;
+    Page * page = nullptr;
+    for(Page & candidate : pages) {
+        if(allocate(candidate, image->w + 2, image->h + 2, rect)) {
+            page = &candidate;
+            break;
+        }
+    }
+
+    if(page == nullptr) {
+        std::vector<Uint32> blank(ATLAS_PAGE_SIZE * ATLAS_PAGE_SIZE, 0);
+        pages.push_back({ device->create_texture(ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE, GL_RGBA, GL_UNSIGNED_BYTE, blank.data()), RectPacker(ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE), 0, {}, {} });
+        page = &pages.back();
+        page->packer.pack(image->w + 2, image->h + 2, rect);
+    }
+
+    GLenum format, type;
+    get_upload_format(image, format, type);
+    const Uint8 * pixels = (const Uint8 *)image->pixels;
+    int w = image->w;
+    int h = image->h;
+    int bytes = image->format->BytesPerPixel;
+    int row_length = image->pitch / bytes;
+    device->update_texture(page->texture, rect.x + 1, rect.y + 1, w, h, format, type, pixels, row_length);
+    device->update_texture(page->texture, rect.x + 1, rect.y, w, 1, format, type, pixels, row_length);
+    device->update_texture(page->texture, rect.x + 1, rect.y + h + 1, w, 1, format, type, pixels + (h - 1) * image->pitch, row_length);
+    device->update_texture(page->texture, rect.x, rect.y + 1, 1, h, format, type, pixels, row_length);
+    device->update_texture(page->texture, rect.x + w + 1, rect.y + 1, 1, h, format, type, pixels + (w - 1) * bytes, row_length);
+    page->references++;
+    texture = page->texture;
+    uv = Rect2((double)(rect.x + 1) / ATLAS_PAGE_SIZE, (double)(rect.y + 1) / ATLAS_PAGE_SIZE, (double)w / ATLAS_PAGE_SIZE, (double)h / ATLAS_PAGE_SIZE);
+    return true;
+}
+
+void TextureAtlas::release(GLuint texture, const Rect2 & uv) {
+    for(Page & page : pages) {
+        if(page.texture != texture)
+            continue;
+        
+        int x = lround(uv.position.x * ATLAS_PAGE_SIZE) - 1;
+        int y = lround(uv.position.y * ATLAS_PAGE_SIZE) - 1;
+        int w = lround(uv.size.x * ATLAS_PAGE_SIZE) + 2;
+        int h = lround(uv.size.y * ATLAS_PAGE_SIZE) + 2;
+        page.released.push_back({ x, y, w, h });
+        page.references--;
+        return;
+    }
+}
+
+void TextureAtlas::reclaim() {
+    bool kept_empty = false;
+    for(size_t i = 0; i < pages.size(); i++) {
+        Page & page = pages[i];
+        if(page.references > 0) {
+            page.free_rects.insert(page.free_rects.end(), page.released.begin(), page.released.end());
+            page.released.clear();
+            continue;
+        }
+
+        if(kept_empty) {
+            device->delete_texture(page.texture);
+            pages.erase(pages.begin() + i);
+            i--;
+            continue;
+        }
+
+        page.packer.clear();
+        page.free_rects.clear();
+        page.released.clear();
+        kept_empty = true;
+    }
+}
\ No newline at end of file
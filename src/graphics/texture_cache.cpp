@@ -0,0 +1,250 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#include "graphics/texture_cache.h"
+#include "graphics/texture.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+static int count_levels(int width, int height) {
+    int levels = 1;
+    while(width > 1 || height > 1) {
+        width = width > 1 ? width / 2 : 1;
+        height = height > 1 ? height / 2 : 1;
+        levels++;
+    }
+
+    return levels;
+}
+
+static uint32_t get_level_size(int width, int height, bool compressed) {
+    if(compressed)
+        return (uint32_t)((width + 3) / 4) * ((height + 3) / 4) * 16;
+    
+    return (uint32_t)width * height * 4;
+}
+
+static void set_mipmap_parameters(int levels) {
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levels - 1);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+}
+
+uint64_t hash_texture_data(const void * data, size_t size) {
+    const Uint8 * bytes = (const Uint8 *)data;
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for(size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3ull;
+    }
+
+    return hash;
+}
+
+GLuint load_cached_texture(const char * path, uint64_t hash, int & width, int & height) {
+    int fd = open(path, O_RDONLY);
+    if(fd == -1)
+        return 0;
+    
+    struct stat info;
+    if(fstat(fd, &info) == -1 || (size_t)info.st_size < sizeof(TextureCacheHeader)) {
+        close(fd);
+        return 0;
+    }
+
+    size_t size = info.st_size;
+    void * mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if(mapping == MAP_FAILED)
+        return 0;
+    
+    const TextureCacheHeader * header = (const TextureCacheHeader *)mapping;
+    bool compressed = header->format != GL_RGBA8;
+    GLint max_size;
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &max_size);
+    if(header->magic != TEXTURE_CACHE_MAGIC || header->version != TEXTURE_CACHE_VERSION || header->hash != hash || (compressed && (header->format != GL_COMPRESSED_RGBA_S3TC_DXT5_EXT || !GLEW_EXT_texture_compression_s3tc))) {
+        munmap(mapping, size);
+        return 0;
+    }
+
+    if(header->width == 0 || header->height == 0 || header->width > (uint32_t)max_size || header->height > (uint32_t)max_size || header->levels != (uint32_t)count_levels(header->width, header->height)) {
+        munmap(mapping, size);
+        return 0;
+    }
+
+    GLint previous;
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous);
+    GLuint texture;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    const Uint8 * cursor = (const Uint8 *)(header + 1);
+    const Uint8 * end = (const Uint8 *)mapping + size;
+    int w = header->width;
+    int h = header->height;
+    bool valid = true;
+    for(uint32_t level = 0; level < header->levels; level++) {
+        uint32_t level_size;
+        if(cursor + sizeof(level_size) > end) {
+            valid = false;
+            break;
+        }
+
+        memcpy(&level_size, cursor, sizeof(level_size));
+        cursor += sizeof(level_size);
+        // GL reads as many bytes as the level's dimensions call for, whatever the file says.
+        if(level_size != get_level_size(w, h, compressed) || level_size > (size_t)(end - cursor)) {
+            valid = false;
+            break;
+        }
+
+        if(compressed)
+            glCompressedTexImage2D(GL_TEXTURE_2D, level, header->format, w, h, 0, level_size, cursor);
+        else
+            glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, cursor);
+        
+        cursor += level_size;
+        w = w > 1 ? w / 2 : 1;
+        h = h > 1 ? h / 2 : 1;
+    }
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    set_mipmap_parameters(header->levels);
+    glBindTexture(GL_TEXTURE_2D, previous);
+    width = header->width;
+    height = header->height;
+    munmap(mapping, size);
+    if(!valid) {
+        glDeleteTextures(1, &texture);
+        return 0;
+    }
+
+    return texture;
+}
+
+GLuint upload_mipmapped_texture(SDL_Surface * image) {
+    GLenum format, type;
+    get_upload_format(image, format, type);
+    int levels = count_levels(image->w, image->h);
+    GLint previous;
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous);
+    GLuint texture;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    begin_upload(image);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, image->w, image->h, 0, format, type, image->pixels);
+    end_upload();
+    glGenerateMipmap(GL_TEXTURE_2D);
+    set_mipmap_parameters(levels);
+    if(!GLEW_EXT_texture_compression_s3tc) {
+        glBindTexture(GL_TEXTURE_2D, previous);
+        return texture;
+    }
+
+    GLuint compressed;
+    glGenTextures(1, &compressed);
+    std::vector<Uint8> pixels;
+    int w = image->w;
+    int h = image->h;
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    for(int level = 0; level < levels; level++) {
+        pixels.resize((size_t)w * h * 4);
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glGetTexImage(GL_TEXTURE_2D, level, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+        glBindTexture(GL_TEXTURE_2D, compressed);
+        glTexImage2D(GL_TEXTURE_2D, level, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+        w = w > 1 ? w / 2 : 1;
+        h = h > 1 ? h / 2 : 1;
+    }
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    set_mipmap_parameters(levels);
+    glBindTexture(GL_TEXTURE_2D, previous);
+    glDeleteTextures(1, &texture);
+    return compressed;
+}
+
+bool save_cached_texture(const char * path, uint64_t hash, GLuint texture, int width, int height) {
+    TextureCacheHeader header = { TEXTURE_CACHE_MAGIC, TEXTURE_CACHE_VERSION, hash, (uint32_t)width, (uint32_t)height, GL_RGBA8, (uint32_t)count_levels(width, height) };
+    GLint compressed = GL_FALSE;
+    GLint previous;
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_COMPRESSED, &compressed);
+    if(compressed) {
+        GLint format;
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &format);
+        header.format = format;
+    }
+
+    std::string temporary = std::string(path) + ".tmp";
+    FILE * file = fopen(temporary.c_str(), "wb");
+    if(file == nullptr) {
+        glBindTexture(GL_TEXTURE_2D, previous);
+        SDL_LogWarn(SDL_LOG_CATEGORY_APPLICATION, "Unable to write texture cache %s!", path);
+        return false;
+    }
+
+    bool success = fwrite(&header, sizeof(header), 1, file) == 1;
+    std::vector<Uint8> pixels;
+    int w = width;
+    int h = height;
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    for(uint32_t level = 0; level < header.levels; level++) {
+        uint32_t level_size;
+        if(compressed) {
+            GLint size;
+            glGetTexLevelParameteriv(GL_TEXTURE_2D, level, GL_TEXTURE_COMPRESSED_IMAGE_SIZE, &size);
+            level_size = size;
+            pixels.resize(level_size);
+            glGetCompressedTexImage(GL_TEXTURE_2D, level, pixels.data());
+        } else {
+            level_size = (uint32_t)w * h * 4;
+            pixels.resize(level_size);
+            glGetTexImage(GL_TEXTURE_2D, level, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+        }
+
+        success = success && fwrite(&level_size, sizeof(level_size), 1, file) == 1;
+        success = success && fwrite(pixels.data(), 1, level_size, file) == level_size;
+        w = w > 1 ? w / 2 : 1;
+        h = h > 1 ? h / 2 : 1;
+    }
+
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glBindTexture(GL_TEXTURE_2D, previous);
+    success = fclose(file) == 0 && success;
+    success = success && rename(temporary.c_str(), path) == 0;
+    if(!success)
+        unlink(temporary.c_str());
+    
+    return success;
+}
\ No newline at end of file
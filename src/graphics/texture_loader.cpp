@@ -0,0 +1,189 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#include "graphics/texture_loader.h"
+#include "graphics/texture.h"
+#include "graphics/texture_atlas.h"
+#include "graphics/renderer.h"
+#include "graphics/texture_cache.h"
+#include <SDL2/SDL_image.h>
+#include <unistd.h>
+
+TextureLoader::TextureLoader() {
+    unsigned int count = std::thread::hardware_concurrency() / 2;
+    if(count < 1)
+        count = 1;
+    
+    if(count > 4)
+        count = 4;
+    
+    decoding.resize(count, nullptr);
+    for(size_t i = 0; i < count; i++)
+        workers.emplace_back(&TextureLoader::work, this, i);
+}
+
+TextureLoader::~TextureLoader() {
+    {
+        std::lock_guard lock(mutex);
+        quit = true;
+    }
+
+    condition.notify_all();
+    for(std::thread & worker : workers)
+        worker.join();
+    
+    for(Job & job : decoded)
+        SDL_FreeSurface(job.image);
+    
+    for(Job & job : uploading)
+        SDL_FreeSurface(job.image);
+}
+
+void TextureLoader::work(size_t index) {
+    while(true) {
+        Job job;
+        {
+            std::unique_lock lock(mutex);
+            condition.wait(lock, [this] { return quit || !pending.empty(); });
+            if(quit)
+                return;
+            
+            job = std::move(pending.front());
+            pending.pop_front();
+            decoding[index] = job.texture;
+        }
+
+        std::vector<Uint8> data;
+        if(read_texture_file(job.path.c_str(), data)) {
+            std::string cache_path = job.path + TEXTURE_CACHE_EXTENSION;
+            job.cached = !job.skip_cache && access(cache_path.c_str(), F_OK) == 0;
+            if(!job.cached)
+                job.image = prepare_surface(IMG_Load_RW(SDL_RWFromConstMem(data.data(), data.size()), 1));
+            
+            if(job.cached || (job.image != nullptr && (job.image->w > ATLAS_MAX_SPRITE_SIZE || job.image->h > ATLAS_MAX_SPRITE_SIZE)))
+                job.hash = hash_texture_data(data.data(), data.size());
+        }
+
+        if(!job.cached && job.image == nullptr)
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Unable to load texture %s! (%s)", job.path.c_str(), IMG_GetError());
+        
+        std::lock_guard lock(mutex);
+        if(decoding[index] == job.texture)
+            decoded.push_back(std::move(job));
+        else if(job.image)
+            SDL_FreeSurface(job.image);
+        
+        decoding[index] = nullptr;
+    }
+}
+
+void TextureLoader::load(Texture * texture, const char * path) {
+    {
+        std::lock_guard lock(mutex);
+        pending.push_back({ texture, path });
+    }
+
+    condition.notify_one();
+}
+
+void TextureLoader::cancel(Texture * texture) {
+    std::lock_guard lock(mutex);
+    for(auto it = pending.begin(); it != pending.end();) {
+        if(it->texture == texture)
+            it = pending.erase(it);
+        else
+            it++;
+    }
+
+    for(auto it = decoded.begin(); it != decoded.end();) {
+        if(it->texture == texture) {
+            SDL_FreeSurface(it->image);
+            it = decoded.erase(it);
+        } else
+            it++;
+    }
+
+    for(auto it = uploading.begin(); it != uploading.end();) {
+        if(it->texture == texture) {
+            SDL_FreeSurface(it->image);
+            it = uploading.erase(it);
+        } else
+            it++;
+    }
+
+    for(Texture *& current : decoding) {
+        if(current == texture)
+            current = nullptr;
+    }
+}
+
+void TextureLoader::update(size_t budget) {
+    {
+        std::lock_guard lock(mutex);
+        while(!decoded.empty()) {
+            uploading.push_back(std::move(decoded.front()));
+            decoded.pop_front();
+        }
+    }
+
+    while(!uploading.empty() && budget > 0) {
+        Job & job = uploading.front();
+        Texture * texture = job.texture;
+        bool cacheable = texture->renderer->get_device()->has_context();
+        std::string cache_path = job.path + TEXTURE_CACHE_EXTENSION;
+        size_t size = 0;
+        if(job.cached) {
+            if(!cacheable || !texture->load_cached_image(cache_path, job.hash)) {
+                Job retry = std::move(job);
+                retry.cached = false;
+                retry.skip_cache = true;
+                uploading.pop_front();
+                {
+                    std::lock_guard lock(mutex);
+                    pending.push_back(std::move(retry));
+                }
+
+                condition.notify_one();
+                continue;
+            }
+
+            size = (size_t)texture->width * texture->height * 4;
+        } else if(job.image != nullptr) {
+            SDL_Surface * image = job.image;
+            if(!cacheable || (image->w <= ATLAS_MAX_SPRITE_SIZE && image->h <= ATLAS_MAX_SPRITE_SIZE))
+                texture->set_image(image);
+            else
+                texture->set_mipmapped_image(image, cache_path, job.hash);
+            
+            size = (size_t)image->h * image->pitch;
+            SDL_FreeSurface(image);
+        }
+
+        budget = size < budget ? budget - size : 0;
+        uploading.pop_front();
+        std::function<void(Texture *, bool)> callback = std::move(texture->on_ready);
+        texture->on_ready = nullptr;
+        if(callback)
+            callback(texture, texture->is_ready());
+    }
+}
\ No newline at end of file
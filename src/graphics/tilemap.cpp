@@ -0,0 +1,145 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#include "graphics/tilemap.h"
+#include "graphics/renderer.h"
+#include "graphics/texture.h"
+#include <math.h>
+
+TileMap::TileMap(Renderer * renderer, Texture * tileset, int width, int height, double tile_width, double tile_height) : renderer(renderer), tileset(tileset), width(width), height(height), tile_width(tile_width), tile_height(tile_height) {
+    tiles.resize((size_t)width * height, -1);
+    chunks_x = (width + TILEMAP_CHUNK_SIZE - 1) / TILEMAP_CHUNK_SIZE;
+    chunks_y = (height + TILEMAP_CHUNK_SIZE - 1) / TILEMAP_CHUNK_SIZE;
+    chunks.resize((size_t)chunks_x * chunks_y);
+}
+
+TileMap::~TileMap() {
+    for(const Chunk & chunk : chunks) {
+        if(chunk.buffer)
+            renderer->release_buffer(chunk.buffer);
+    }
+}
+
+void TileMap::set_tile(int x, int y, int tile) {
+    if(x < 0 || y < 0 || x >= width || y >= height)
+        return;
+    
+    int & current = tiles[(size_t)y * width + x];
+    if(current != tile) {
+        current = tile;
+        chunks[(size_t)(y / TILEMAP_CHUNK_SIZE) * chunks_x + x / TILEMAP_CHUNK_SIZE].dirty = true;
+    }
+}
+
+int TileMap::get_tile(int x, int y) const {
+    if(x < 0 || y < 0 || x >= width || y >= height)
+        return -1;
+    
+    return tiles[(size_t)y * width + x];
+}
+
+void TileMap::set_tileset(Texture * tileset) {
+    this->tileset = tileset;
+    for(Chunk & chunk : chunks)
+        chunk.dirty = true;
+}
+
+void TileMap::set_position(const Vector2 & position) {
+    this->position = position;
+}
+
+void TileMap::build_chunk(int chunk_x, int chunk_y) {
+    Chunk & chunk = chunks[(size_t)chunk_y * chunks_x + chunk_x];
+    const Rect2 & uv = tileset->get_uv();
+    int columns = tileset->get_width() / tile_width;
+    int rows = tileset->get_height() / tile_height;
+    float tile_u = uv.size.x * tile_width / tileset->get_width();
+    float tile_v = uv.size.y * tile_height / tileset->get_height();
+    std::vector<Vertex> vertices;
+    vertices.reserve(TILEMAP_CHUNK_SIZE * TILEMAP_CHUNK_SIZE * 6);
+    for(int y = chunk_y * TILEMAP_CHUNK_SIZE; y < (chunk_y + 1) * TILEMAP_CHUNK_SIZE && y < height; y++) {
+        for(int x = chunk_x * TILEMAP_CHUNK_SIZE; x < (chunk_x + 1) * TILEMAP_CHUNK_SIZE && x < width; x++) {
+            int tile = tiles[(size_t)y * width + x];
+            if(tile < 0 || columns <= 0 || tile >= columns * rows)
+                continue;
+            
+            float x0 = x * tile_width;
+            float y0 = y * tile_height;
+            float x1 = x0 + tile_width;
+            float y1 = y0 + tile_height;
+            float u0 = uv.position.x + (tile % columns) * tile_u;
+            float v0 = uv.position.y + (tile / columns) * tile_v;
+            float u1 = u0 + tile_u;
+            float v1 = v0 + tile_v;
+            vertices.push_back({ x0, y0, u0, v0, 255, 255, 255, 255 });
+            vertices.push_back({ x1, y0, u1, v0, 255, 255, 255, 255 });
+            vertices.push_back({ x1, y1, u1, v1, 255, 255, 255, 255 });
+            vertices.push_back({ x0, y0, u0, v0, 255, 255, 255, 255 });
+            vertices.push_back({ x1, y1, u1, v1, 255, 255, 255, 255 });
+            vertices.push_back({ x0, y1, u0, v1, 255, 255, 255, 255 });
+        }
+    }
+
+    if(chunk.buffer) {
+        renderer->release_buffer(chunk.buffer);
+        chunk.buffer = 0;
+    }
+
+    chunk.count = vertices.size();
+    if(chunk.count > 0)
+        chunk.buffer = renderer->get_device()->create_buffer(vertices.data(), vertices.size());
+    
+    chunk.dirty = false;
+}
+
+void TileMap::draw() {
+    if(tileset == nullptr || !tileset->is_ready())
+        return;
+    
+    const Rect2 & view = renderer->get_view();
+    int first_x = floor((view.position.x - position.x) / (tile_width * TILEMAP_CHUNK_SIZE));
+    int first_y = floor((view.position.y - position.y) / (tile_height * TILEMAP_CHUNK_SIZE));
+    int last_x = floor((view.position.x + view.size.x - position.x) / (tile_width * TILEMAP_CHUNK_SIZE));
+    int last_y = floor((view.position.y + view.size.y - position.y) / (tile_height * TILEMAP_CHUNK_SIZE));
+    if(first_x < 0)
+        first_x = 0;
+    
+    if(first_y < 0)
+        first_y = 0;
+    
+    if(last_x >= chunks_x)
+        last_x = chunks_x - 1;
+    
+    if(last_y >= chunks_y)
+        last_y = chunks_y - 1;
+    
+    for(int y = first_y; y <= last_y; y++) {
+        for(int x = first_x; x <= last_x; x++) {
+            Chunk & chunk = chunks[(size_t)y * chunks_x + x];
+            if(chunk.dirty)
+                build_chunk(x, y);
+            
+            renderer->draw_buffer(chunk.buffer, GL_TRIANGLES, tileset->get_texture(), chunk.count, position);
+        }
+    }
+}
\ No newline at end of file
@@ -32,8 +32,12 @@ Rect2::Rect2(const Vector2 & position, const Vector2 & size) : position(position
 
 Rect2::Rect2(double x, double y, double width, double height) : position(Vector2(x, y)), size(Vector2(width, height)) {}
 
+bool Rect2::intersects(const Rect2 & with) const {
+    return position.x <= (with.position.x + with.size.x) && (position.x + size.x) >= with.position.x && position.y <= (with.position.y + with.size.y) && (position.y + size.y) >= with.position.y;
+}
+
 Rect2 Rect2::intersect(const Rect2 & with) {
-    if(!(position.x <= (with.position.x + with.size.x) && (position.x + size.x) >= with.position.x && position.y <= (with.position.y + with.size.y) && (position.y + size.y) >= with.position.y))
+    if(!intersects(with))
         return Rect2();
     
     double max_x = (position.x >= with.position.x) ? position.x : with.position.x;
@@ -32,13 +32,7 @@ Vector2::Vector2(double x, double y) : x(x), y(y) {}
 
 Vector2 Vector2::normalized() {
     Vector2 v = *this;
-    double l = v.x * v.x + v.y * v.y;
-    if(l != 0) {
-        l = sqrt(l);
-        v.x /= l;
-        v.y /= l;
-    }
-
+    v.normalize_in_place();
     return v;
 }
 
@@ -55,4 +49,33 @@ Vector2 Vector2::project(const Vector2 & to) {
     v.x = to.x * (dot(to) / (to.x * to.x + to.y * to.y));
     v.y = to.y * (dot(to) / (to.x * to.x + to.y * to.y));
     return v;
+}
+
+void Vector2::set(double x, double y) {
+    this->x = x;
+    this->y = y;
+}
+
+void Vector2::add_in_place(const Vector2 & other) {
+    x += other.x;
+    y += other.y;
+}
+
+void Vector2::scale_in_place(double s) {
+    x *= s;
+    y *= s;
+}
+
+void Vector2::mad(const Vector2 & other, double s) {
+    x += other.x * s;
+    y += other.y * s;
+}
+
+void Vector2::normalize_in_place() {
+    double l = x * x + y * y;
+    if(l != 0) {
+        l = sqrt(l);
+        x /= l;
+        y /= l;
+    }
 }
\ No newline at end of file
@@ -0,0 +1,231 @@
+/******************************************************************************/
+/* Copyright (c) 2024 Taliesin Perscilla "FlutterTal" Ambroise                */
+/******************************************************************************/
+/* This software is provided ‘as-is’, without any express or implied          */
+/* warranty. In no event will the authors be held liable for any damages      */
+/* arising from the use of this software.                                     */
+/*                                                                            */
+/* Permission is granted to anyone to use this software for any purpose,      */
+/* including commercial applications, and to alter it and redistribute it     */
+/* freely, subject to the following restrictions:                             */
+/*                                                                            */
+/* 1. The origin of this software must not be misrepresented; you must not    */
+/* claim that you wrote the original software. If you use this software       */
+/* in a product, an acknowledgment in the product documentation would be      */
+/* appreciated but is not required.                                           */
+/*                                                                            */
+/* 2. Altered source versions must be plainly marked as such, and must not be */
+/* misrepresented as being the original software.                             */
+/*                                                                            */
+/* 3. This notice may not be removed or altered from any source               */
+/* distribution.                                                              */
+/******************************************************************************/
+
+#include "math/vector2_array.h"
+#include <math.h>
+#include <string.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+Vector2Array::Vector2Array(size_t count) : storage(count * 2, 0.0), xs(storage.data()), ys(storage.data() + count), count(count) {}
+
+void Vector2Array::attach(void * data, size_t count) {
+    xs = (double *)data;
+    ys = xs + count;
+    this->count = count;
+    attached = true;
+}
+
+void Vector2Array::resize(size_t count) {
+    std::vector<double> next(count * 2, 0.0);
+    size_t kept = count < this->count ? count : this->count;
+    memcpy(next.data(), xs, kept * sizeof(double));
+    memcpy(next.data() + count, ys, kept * sizeof(double));
+    storage.swap(next);
+    xs = storage.data();
+    ys = storage.data() + count;
+    this->count = count;
+    attached = false;
+}
+
+void Vector2Array::set(size_t index, const Vector2 & value) {
+    xs[index] = value.x;
+    ys[index] = value.y;
+}
+
+void Vector2Array::fill(const Vector2 & value) {
+    for(size_t i = 0; i < count; i++) {
+        xs[i] = value.x;
+        ys[i] = value.y;
+    }
+}
+
+void Vector2Array::add(const Vector2 & offset) {
+    size_t i = 0;
+#ifdef __SSE2__
+    __m128d ox = _mm_set1_pd(offset.x);
+    __m128d oy = _mm_set1_pd(offset.y);
+    for(; i + 2 <= count; i += 2) {
+        _mm_storeu_pd(xs + i, _mm_add_pd(_mm_loadu_pd(xs + i), ox));
+        _mm_storeu_pd(ys + i, _mm_add_pd(_mm_loadu_pd(ys + i), oy));
+    }
+#endif
+    for(; i < count; i++) {
+        xs[i] += offset.x;
+        ys[i] += offset.y;
+    }
+}
+
+void Vector2Array::add(const Vector2Array & other) {
+    mad(other, 1.0);
+}
+
+void Vector2Array::scale(double s) {
+    size_t i = 0;
+#ifdef __SSE2__
+    __m128d vs = _mm_set1_pd(s);
+    for(; i + 2 <= count; i += 2) {
+        _mm_storeu_pd(xs + i, _mm_mul_pd(_mm_loadu_pd(xs + i), vs));
+        _mm_storeu_pd(ys + i, _mm_mul_pd(_mm_loadu_pd(ys + i), vs));
+    }
+#endif
+    for(; i < count; i++) {
+        xs[i] *= s;
+        ys[i] *= s;
+    }
+}
+
+void Vector2Array::mad(const Vector2Array & other, double s) {
+    size_t n = count < other.count ? count : other.count;
+    size_t i = 0;
+#ifdef __SSE2__
+    __m128d vs = _mm_set1_pd(s);
+    for(; i + 2 <= n; i += 2) {
+        _mm_storeu_pd(xs + i, _mm_add_pd(_mm_loadu_pd(xs + i), _mm_mul_pd(_mm_loadu_pd(other.xs + i), vs)));
+        _mm_storeu_pd(ys + i, _mm_add_pd(_mm_loadu_pd(ys + i), _mm_mul_pd(_mm_loadu_pd(other.ys + i), vs)));
+    }
+#endif
+    for(; i < n; i++) {
+        xs[i] += other.xs[i] * s;
+        ys[i] += other.ys[i] * s;
+    }
+}
+
+void Vector2Array::normalize() {
+    size_t i = 0;
+#ifdef __SSE2__
+    __m128d zero = _mm_setzero_pd();
+    for(; i + 2 <= count; i += 2) {
+        __m128d x = _mm_loadu_pd(xs + i);
+        __m128d y = _mm_loadu_pd(ys + i);
+        __m128d length = _mm_sqrt_pd(_mm_add_pd(_mm_mul_pd(x, x), _mm_mul_pd(y, y)));
+        __m128d nonzero = _mm_cmpneq_pd(length, zero);
+        x = _mm_or_pd(_mm_and_pd(nonzero, _mm_div_pd(x, length)), _mm_andnot_pd(nonzero, x));
+        y = _mm_or_pd(_mm_and_pd(nonzero, _mm_div_pd(y, length)), _mm_andnot_pd(nonzero, y));
+        _mm_storeu_pd(xs + i, x);
+        _mm_storeu_pd(ys + i, y);
+    }
+#endif
+    for(; i < count; i++) {
+        double length = sqrt(xs[i] * xs[i] + ys[i] * ys[i]);
+        if(length != 0) {
+            xs[i] /= length;
+            ys[i] /= length;
+        }
+    }
+}
+
+void Vector2Array::get_lengths(double * lengths) const {
+    size_t i = 0;
+#ifdef __SSE2__
+    for(; i + 2 <= count; i += 2) {
+        __m128d x = _mm_loadu_pd(xs + i);
+        __m128d y = _mm_loadu_pd(ys + i);
+        _mm_storeu_pd(lengths + i, _mm_sqrt_pd(_mm_add_pd(_mm_mul_pd(x, x), _mm_mul_pd(y, y))));
+    }
+#endif
+    for(; i < count; i++)
+        lengths[i] = sqrt(xs[i] * xs[i] + ys[i] * ys[i]);
+}
+
+void Vector2Array::clamp(const Rect2 & rect) {
+    double left = fmin(rect.position.x, rect.position.x + rect.size.x);
+    double right = fmax(rect.position.x, rect.position.x + rect.size.x);
+    double top = fmin(rect.position.y, rect.position.y + rect.size.y);
+    double bottom = fmax(rect.position.y, rect.position.y + rect.size.y);
+    size_t i = 0;
+#ifdef __SSE2__
+    __m128d min_x = _mm_set1_pd(left);
+    __m128d max_x = _mm_set1_pd(right);
+    __m128d min_y = _mm_set1_pd(top);
+    __m128d max_y = _mm_set1_pd(bottom);
+    for(; i + 2 <= count; i += 2) {
+        _mm_storeu_pd(xs + i, _mm_min_pd(_mm_max_pd(_mm_loadu_pd(xs + i), min_x), max_x));
+        _mm_storeu_pd(ys + i, _mm_min_pd(_mm_max_pd(_mm_loadu_pd(ys + i), min_y), max_y));
+    }
+#endif
+    for(; i < count; i++) {
+        xs[i] = xs[i] < left ? left : xs[i] > right ? right : xs[i];
+        ys[i] = ys[i] < top ? top : ys[i] > bottom ? bottom : ys[i];
+    }
+}
+
+long Vector2Array::nearest(const Vector2 & point) const {
+    long best = -1;
+    double best_distance = INFINITY;
+    size_t i = 0;
+#ifdef __SSE2__
+    __m128d px = _mm_set1_pd(point.x);
+    __m128d py = _mm_set1_pd(point.y);
+    for(; i + 2 <= count; i += 2) {
+        __m128d dx = _mm_sub_pd(_mm_loadu_pd(xs + i), px);
+        __m128d dy = _mm_sub_pd(_mm_loadu_pd(ys + i), py);
+        double distances[2];
+        _mm_storeu_pd(distances, _mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy)));
+        for(int k = 0; k < 2; k++) {
+            if(distances[k] < best_distance) {
+                best_distance = distances[k];
+                best = i + k;
+            }
+        }
+    }
+#endif
+    for(; i < count; i++) {
+        double dx = xs[i] - point.x;
+        double dy = ys[i] - point.y;
+        if(dx * dx + dy * dy < best_distance) {
+            best_distance = dx * dx + dy * dy;
+            best = i;
+        }
+    }
+
+    return best;
+}
+
+void Vector2Array::find_within(const Vector2 & point, double radius, std::vector<size_t> & indices) const {
+    indices.clear();
+    double limit = radius * radius;
+    size_t i = 0;
+#ifdef __SSE2__
+    __m128d px = _mm_set1_pd(point.x);
+    __m128d py = _mm_set1_pd(point.y);
+    __m128d vlimit = _mm_set1_pd(limit);
+    for(; i + 2 <= count; i += 2) {
+        __m128d dx = _mm_sub_pd(_mm_loadu_pd(xs + i), px);
+        __m128d dy = _mm_sub_pd(_mm_loadu_pd(ys + i), py);
+        int mask = _mm_movemask_pd(_mm_cmple_pd(_mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy)), vlimit));
+        if(mask & 1)
+            indices.push_back(i);
+        
+        if(mask & 2)
+            indices.push_back(i + 1);
+    }
+#endif
+    for(; i < count; i++) {
+        double dx = xs[i] - point.x;
+        double dy = ys[i] - point.y;
+        if(dx * dx + dy * dy <= limit)
+            indices.push_back(i);
+    }
+}
\ No newline at end of file
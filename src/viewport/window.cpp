@@ -24,22 +24,18 @@
 #include "viewport/window.h"
 #include <SDL2/SDL_image.h>
 
-Window::Window(const char * title, int w, int h, const char * icon_path, bool resizable, bool always_on_top, bool borderless, bool fullscreen) {
+Window::Window(const char * title, int w, int h, const char * icon_path, bool resizable, bool always_on_top, bool borderless, bool fullscreen, bool opengl) {
     SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
     SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 1);
     SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
-    window = SDL_CreateWindow(title, SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, w, h, SDL_WINDOW_SHOWN | SDL_WINDOW_OPENGL);
+    window = SDL_CreateWindow(title, SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, w, h, SDL_WINDOW_SHOWN | (opengl ? SDL_WINDOW_OPENGL : 0));
     if(window == nullptr) {
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Could not create the window! (%s)", SDL_GetError());
         return;
     }
 
-    context = SDL_GL_CreateContext(window);
-    if(context == nullptr) {
-        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Could not create OpenGL context! (%s)", SDL_GetError());
-        SDL_DestroyWindow(window);
-        return;
-    }
+    if(opengl)
+        create_context();
 
     if(icon_path != nullptr && icon_path != "") {
         SDL_Surface * surface = IMG_Load(icon_path);
@@ -53,8 +49,23 @@ Window::Window(const char * title, int w, int h, const char * icon_path, bool re
     SDL_SetWindowFullscreen(window, fullscreen ? SDL_WINDOW_FULLSCREEN_DESKTOP : 0);
 }
 
+void Window::create_context() {
+    context = SDL_GL_CreateContext(window);
+    if(context == nullptr) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Could not create OpenGL context! (%s)", SDL_GetError());
+        return;
+    }
+
+    glewExperimental = GL_TRUE;
+    GLenum error = glewInit();
+    if(error != GLEW_OK)
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Could not initialize GLEW! (%s)", glewGetErrorString(error));
+}
+
 Window::~Window() {
-    SDL_GL_DeleteContext(context);
+    if(context != nullptr)
+        SDL_GL_DeleteContext(context);
+    
     SDL_DestroyWindow(window);
 }
 
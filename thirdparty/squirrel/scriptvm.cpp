@@ -56,6 +56,7 @@ ScriptVM::ScriptVM() {
     sq_setprintfunc(v, printfunc, errorfunc);
     sqstd_seterrorhandlers(v);
     sq_pushroottable(v);
+    sq_getstackobj(v, -1, &root);
     {
         sq_pushroottable(v);
         sq_pushstring(v, _SC("Mousey"), -1);
@@ -75,11 +76,50 @@ ScriptVM::ScriptVM() {
     sqstd_register_mathlib(v);
     sqstd_register_systemlib(v);
     sqstd_register_stringlib(v);
-    sqstd_dofile(v, "main.nut", SQFalse, SQTrue);
 }
 
 ScriptVM::~ScriptVM() {
+    close();
+}
+
+void ScriptVM::load(const char * path) {
+    sqstd_dofile(v, path, SQFalse, SQTrue);
+}
+
+void ScriptVM::close() {
+    if(v == nullptr)
+        return;
+    
     sq_collectgarbage(v);
     sq_pop(v, 1);
     sq_close(v);
+    v = nullptr;
+}
+
+void ScriptVM::bind_callback(ScriptCallback & callback, const SQChar * name) {
+    sq_pushstring(v, name, -1);
+    sq_getstackobj(v, -1, &callback.name);
+    sq_addref(v, &callback.name);
+    sq_pop(v, 1);
+    sq_resetobject(&callback.function);
+    refresh_callback(callback);
+}
+
+void ScriptVM::refresh_callback(ScriptCallback & callback) {
+    HSQOBJECT function;
+    sq_resetobject(&function);
+    sq_pushobject(v, root);
+    sq_pushobject(v, callback.name);
+    if(SQ_SUCCEEDED(sq_rawget(v, -2))) {
+        sq_getstackobj(v, -1, &function);
+        sq_pop(v, 1);
+    }
+
+    sq_pop(v, 1);
+    if(function._type == callback.function._type && function._unVal.pRefCounted == callback.function._unVal.pRefCounted)
+        return;
+    
+    sq_addref(v, &function);
+    sq_release(v, &callback.function);
+    callback.function = function;
 }
\ No newline at end of file
@@ -29,8 +29,14 @@
 
 #define SQUSEDOUBLE
 
+struct ScriptCallback {
+    HSQOBJECT name;
+    HSQOBJECT function;
+};
+
 class ScriptVM {
     HSQUIRRELVM v;
+    HSQOBJECT root;
 
     void push_arg(SQInteger i) { sq_pushinteger(v, i); }
     void push_arg(int64_t i) { sq_pushinteger(v, i); }
@@ -42,22 +48,23 @@ class ScriptVM {
 public:
     ScriptVM();
     ~ScriptVM();
+    ScriptVM(const ScriptVM &) = delete;
+    void operator=(const ScriptVM &) = delete;
 
-    template<typename... Args>
-    void call_func_without_return(const SQChar * name, Args... args) {
-        sq_pushroottable(v);
-        sq_pushstring(v, _SC(name), -1);
-        if(SQ_SUCCEEDED(sq_get(v, -2))) {
-            sq_pushroottable(v);
-            (push_arg(args), ...);
-            if(SQ_FAILED(sq_call(v, sizeof...(args) + 1, SQFalse, SQTrue))) {
-                sq_pop(v, 2);
-                return;
-            }
-
-            sq_pop(v, 1);
-        }
+    void load(const char * path);
+    void close();
+    void bind_callback(ScriptCallback & callback, const SQChar * name);
+    void refresh_callback(ScriptCallback & callback);
 
+    template<typename... Args>
+    void call(const ScriptCallback & callback, Args... args) {
+        if(sq_isnull(callback.function))
+            return;
+        
+        sq_pushobject(v, callback.function);
+        sq_pushobject(v, root);
+        (push_arg(args), ...);
+        sq_call(v, sizeof...(args) + 1, SQFalse, SQTrue);
         sq_pop(v, 1);
     }
 };